@@ -0,0 +1,54 @@
+/* blas/gsl_blas_types.h
+ * 
+ * Copyright (C) 1996, 1997, 1998, 1999, 2000 Gerard Jungman
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Author:  G. Jungman
+ */
+/* Based on draft BLAST C interface specification  [Jul 7 1998]
+ */
+#ifndef __GSL_BLAS_TYPES_H__
+#define __GSL_BLAS_TYPES_H__
+
+#include <gsl/gsl_cblas.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef  CBLAS_INDEX  CBLAS_INDEX_t;
+typedef  enum CBLAS_ORDER       CBLAS_ORDER_t;
+typedef  enum CBLAS_TRANSPOSE   CBLAS_TRANSPOSE_t;
+typedef  enum CBLAS_UPLO        CBLAS_UPLO_t;
+typedef  enum CBLAS_DIAG        CBLAS_DIAG_t;
+typedef  enum CBLAS_SIDE        CBLAS_SIDE_t;
+
+/* typedef  gsl_complex  COMPLEX; */
+
+__END_DECLS
+
+
+#endif /* __GSL_BLAS_TYPES_H__ */
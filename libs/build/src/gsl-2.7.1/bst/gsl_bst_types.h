@@ -0,0 +1,48 @@
+/* bst/gsl_bst_types.h
+ * 
+ * Copyright (C) 2019 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_BST_TYPES_H__
+#define __GSL_BST_TYPES_H__
+
+#include <stdlib.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef int gsl_bst_cmp_function (const void * a, const void * b, void * params);
+
+/* allocation routines */
+typedef struct
+{
+  void * (*alloc) (size_t size, void * params);
+  void (*free) (void * block, void * params);
+} gsl_bst_allocator;
+
+__END_DECLS
+
+#endif /* __GSL_BST_TYPES_H__ */
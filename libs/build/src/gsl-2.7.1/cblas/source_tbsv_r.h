@@ -0,0 +1,125 @@
+/* blas/source_tbsv_r.h
+ *
+ * Copyright (C) 1996, 1997, 1998, 1999, 2000 Gerard Jungman
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+{
+  const int nonunit = (Diag == CblasNonUnit);
+  INDEX i, j;
+  const int Trans = (TransA != CblasConjTrans) ? TransA : CblasTrans;
+
+  CHECK_ARGS10(TBSV,order,Uplo,TransA,Diag,N,K,A,lda,X,incX);
+
+  if (N == 0)
+    return;
+
+  /* form  x := inv( A )*x */
+
+  if ((order == CblasRowMajor && Trans == CblasNoTrans && Uplo == CblasUpper)
+      || (order == CblasColMajor && Trans == CblasTrans && Uplo == CblasLower)) {
+    /* backsubstitution */
+    INDEX ix = OFFSET(N, incX) + incX * (N - 1);
+    for (i = N; i > 0 && i--;) {
+      BASE tmp = X[ix];
+      const INDEX j_min = i + 1;
+      const INDEX j_max = GSL_MIN(N, i + K + 1);
+      INDEX jx = OFFSET(N, incX) + j_min * incX;
+      for (j = j_min; j < j_max; j++) {
+        const BASE Aij = A[lda * i + (j - i)];
+        tmp -= Aij * X[jx];
+        jx += incX;
+      }
+      if (nonunit) {
+        X[ix] = tmp / A[lda * i + 0];
+      } else {
+        X[ix] = tmp;
+      }
+      ix -= incX;
+    }
+  } else if ((order == CblasRowMajor && Trans == CblasNoTrans && Uplo == CblasLower)
+             || (order == CblasColMajor && Trans == CblasTrans && Uplo == CblasUpper)) {
+
+    /* forward substitution */
+    INDEX ix = OFFSET(N, incX);
+
+    for (i = 0; i < N; i++) {
+      BASE tmp = X[ix];
+      const INDEX j_min = (i > K ? i - K : 0);
+      const INDEX j_max = i;
+      INDEX jx = OFFSET(N, incX) + j_min * incX;
+      for (j = j_min; j < j_max; j++) {
+        const BASE Aij = A[lda * i + (K + j - i)];
+        tmp -= Aij * X[jx];
+        jx += incX;
+      }
+      if (nonunit) {
+        X[ix] = tmp / A[lda * i + K];
+      } else {
+        X[ix] = tmp;
+      }
+      ix += incX;
+    }
+  } else if ((order == CblasRowMajor && Trans == CblasTrans && Uplo == CblasUpper)
+             || (order == CblasColMajor && Trans == CblasNoTrans && Uplo == CblasLower)) {
+
+    /* form  x := inv( A' )*x */
+
+    /* forward substitution */
+    INDEX ix = OFFSET(N, incX);
+    for (i = 0; i < N; i++) {
+      BASE tmp = X[ix];
+      const INDEX j_min = (K > i ? 0 : i - K);
+      const INDEX j_max = i;
+      INDEX jx = OFFSET(N, incX) + j_min * incX;
+      for (j = j_min; j < j_max; j++) {
+        const BASE Aji = A[(i - j) + lda * j];
+        tmp -= Aji * X[jx];
+        jx += incX;
+      }
+      if (nonunit) {
+        X[ix] = tmp / A[0 + lda * i];
+      } else {
+        X[ix] = tmp;
+      }
+      ix += incX;
+    }
+  } else if ((order == CblasRowMajor && Trans == CblasTrans && Uplo == CblasLower)
+             || (order == CblasColMajor && Trans == CblasNoTrans && Uplo == CblasUpper)) {
+
+    /* backsubstitution */
+    INDEX ix = OFFSET(N, incX) + (N - 1) * incX;
+    for (i = N; i > 0 && i--;) {
+      BASE tmp = X[ix];
+      const INDEX j_min = i + 1;
+      const INDEX j_max = GSL_MIN(N, i + K + 1);
+      INDEX jx = OFFSET(N, incX) + j_min * incX;
+      for (j = j_min; j < j_max; j++) {
+        const BASE Aji = A[(K + i - j) + lda * j];
+        tmp -= Aji * X[jx];
+        jx += incX;
+      }
+      if (nonunit) {
+        X[ix] = tmp / A[K + lda * i];
+      } else {
+        X[ix] = tmp;
+      }
+      ix -= incX;
+    }
+  } else {
+    BLAS_ERROR("unrecognized operation");
+  }
+}
@@ -0,0 +1,115 @@
+  {FN (sqrt_real), -1.0e+01, RES(0, 3.1622776601683793320e0)},
+  {FN (sqrt_real), -2.0e+00, RES(0, 1.4142135623730950488e0)},
+  {FN (sqrt_real), -1.0e+00, RES(0, 1)},
+  {FN (sqrt_real), -7.50e-01, RES(0, 8.6602540378443864676e-1)},
+  {FN (sqrt_real), -5.0e-01, RES(0, 7.0710678118654752440e-1)},
+  {FN (sqrt_real), -1.250e-01, RES(0, 3.5355339059327376220e-1)},
+  {FN (sqrt_real), -3.45266983001243932001e-04, RES(0, 1.8581361171917517303e-2)},
+  {FN (sqrt_real), -1.19209289550781250e-07, RES(0, 3.4526698300124390840e-4)},
+  {FN (sqrt_real), 0.0e+00, RES(0e0, 0.0)},
+  {FN (sqrt_real), 1.19209289550781250e-07, RES(3.4526698300124390840e-4, 0.0)},
+  {FN (sqrt_real), 3.45266983001243932001e-04, RES(1.8581361171917517303e-2, 0.0)},
+  {FN (sqrt_real), 1.250e-01, RES(3.5355339059327376220e-1, 0.0)},
+  {FN (sqrt_real), 5.0e-01, RES(7.0710678118654752440e-1, 0.0)},
+  {FN (sqrt_real), 7.50e-01, RES(8.6602540378443864676e-1, 0.0)},
+  {FN (sqrt_real), 1.0e+00, RES(1e0, 0.0)},
+  {FN (sqrt_real), 2.0e+00, RES(1.4142135623730950488e0, 0.0)},
+  {FN (sqrt_real), 1.0e+01, RES(3.1622776601683793320e0, 0.0)},
+  {FN (arcsin_real), -1.0e+01, RES(-1.5707963267948966192e0, 2.9932228461263808979e0)},
+  {FN (arcsin_real), -2.0e+00, RES(-1.5707963267948966192e0, 1.3169578969248167086e0)},
+  {FN (arcsin_real), -1.0e+00, RES(-1.5707963267948966192e0, 0.0)},
+  {FN (arcsin_real), -7.50e-01, RES(-8.4806207898148100805e-1, 0.0)},
+  {FN (arcsin_real), -5.0e-01, RES(-5.2359877559829887308e-1, 0.0)},
+  {FN (arcsin_real), -1.250e-01, RES(-1.2532783116806539687e-1, 0.0)},
+  {FN (arcsin_real), -3.45266983001243932001e-04, RES(-3.4526698986108292481e-4, 0.0)},
+  {FN (arcsin_real), -1.19209289550781250e-07, RES(-1.1920928955078153234e-7, 0.0)},
+  {FN (arcsin_real), 0.0e+00, RES(0e0, 0.0)},
+  {FN (arcsin_real), 1.19209289550781250e-07, RES(1.1920928955078153234e-7, 0.0)},
+  {FN (arcsin_real), 3.45266983001243932001e-04, RES(3.4526698986108292481e-4, 0.0)},
+  {FN (arcsin_real), 1.250e-01, RES(1.2532783116806539687e-1, 0.0)},
+  {FN (arcsin_real), 5.0e-01, RES(5.2359877559829887308e-1, 0.0)},
+  {FN (arcsin_real), 7.50e-01, RES(8.4806207898148100805e-1, 0.0)},
+  {FN (arcsin_real), 1.0e+00, RES(1.5707963267948966192e0, 0.0)},
+  {FN (arcsin_real), 2.0e+00, RES(1.5707963267948966192e0, -1.3169578969248167086e0)},
+  {FN (arcsin_real), 1.0e+01, RES(1.5707963267948966192e0, -2.9932228461263808979e0)},
+  {FN (arccos_real), -1.0e+01, RES(3.1415926535897932385e0, -2.9932228461263808979e0)},
+  {FN (arccos_real), -2.0e+00, RES(3.1415926535897932385e0, -1.3169578969248167086e0)},
+  {FN (arccos_real), -1.0e+00, RES(3.1415926535897932385e0, 0.0)},
+  {FN (arccos_real), -7.50e-01, RES(2.4188584057763776273e0, 0.0)},
+  {FN (arccos_real), -5.0e-01, RES(2.0943951023931954923e0, 0.0)},
+  {FN (arccos_real), -1.250e-01, RES(1.6961241579629620161e0, 0.0)},
+  {FN (arccos_real), -3.45266983001243932001e-04, RES(1.5711415937847577022e0, 0.0)},
+  {FN (arccos_real), -1.19209289550781250e-07, RES(1.570796446004186170e0, 0.0)},
+  {FN (arccos_real), 0.0e+00, RES(1.5707963267948966192e0, 0.0)},
+  {FN (arccos_real), 1.19209289550781250e-07, RES(1.5707962075856070684e0, 0.0)},
+  {FN (arccos_real), 3.45266983001243932001e-04, RES(1.5704510598050355363e0, 0.0)},
+  {FN (arccos_real), 1.250e-01, RES(1.4454684956268312224e0, 0.0)},
+  {FN (arccos_real), 5.0e-01, RES(1.0471975511965977462e0, 0.0)},
+  {FN (arccos_real), 7.50e-01, RES(7.2273424781341561118e-1, 0.0)},
+  {FN (arccos_real), 1.0e+00, RES(0e0, 0.0)},
+  {FN (arccos_real), 2.0e+00, RES(0, 1.3169578969248167086e0)},
+  {FN (arccos_real), 1.0e+01, RES(0, 2.9932228461263808979e0)},
+  {FN (arccosh_real), -1.0e+01, RES(2.9932228461263808979e0, 3.1415926535897932385e0)},
+  {FN (arccosh_real), -2.0e+00, RES(1.3169578969248167086e0, 3.1415926535897932385e0)},
+  {FN (arccosh_real), -1.0e+00, RES(0, 3.1415926535897932385e0)},
+  {FN (arccosh_real), -7.50e-01, RES(0, 2.4188584057763776273e0)},
+  {FN (arccosh_real), -5.0e-01, RES(0, 2.0943951023931954923e0)},
+  {FN (arccosh_real), -1.250e-01, RES(0, 1.6961241579629620161e0)},
+  {FN (arccosh_real), -3.45266983001243932001e-04, RES(0, 1.5711415937847577022e0)},
+  {FN (arccosh_real), -1.19209289550781250e-07, RES(0, 1.570796446004186170e0)},
+  {FN (arccosh_real), 0.0e+00, RES(0, 1.5707963267948966192e0)},
+  {FN (arccosh_real), 1.19209289550781250e-07, RES(0, 1.5707962075856070684e0)},
+  {FN (arccosh_real), 3.45266983001243932001e-04, RES(0, 1.5704510598050355363e0)},
+  {FN (arccosh_real), 1.250e-01, RES(0, 1.4454684956268312224e0)},
+  {FN (arccosh_real), 5.0e-01, RES(0, 1.0471975511965977462e0)},
+  {FN (arccosh_real), 7.50e-01, RES(0, 7.2273424781341561118e-1)},
+  {FN (arccosh_real), 1.0e+00, RES(0e0, 0.0)},
+  {FN (arccosh_real), 2.0e+00, RES(1.3169578969248167086e0, 0.0)},
+  {FN (arccosh_real), 1.0e+01, RES(2.9932228461263808979e0, 0.0)},
+  {FN (arctanh_real), -1.0e+01, RES(-1.0033534773107558064e-1, 1.5707963267948966192e0)},
+  {FN (arctanh_real), -2.0e+00, RES(-5.4930614433405484570e-1, 1.5707963267948966192e0)},
+  {FN (arctanh_real), -7.50e-01, RES(-9.7295507452765665255e-1, 0.0)},
+  {FN (arctanh_real), -5.0e-01, RES(-5.4930614433405484570e-1, 0.0)},
+  {FN (arctanh_real), -1.250e-01, RES(-1.2565721414045303884e-1, 0.0)},
+  {FN (arctanh_real), -3.45266983001243932001e-04, RES(-3.4526699672092216295e-4, 0.0)},
+  {FN (arctanh_real), -1.19209289550781250e-07, RES(-1.1920928955078181469e-7, 0.0)},
+  {FN (arctanh_real), 0.0e+00, RES(0e0, 0.0)},
+  {FN (arctanh_real), 1.19209289550781250e-07, RES(1.1920928955078181469e-7, 0.0)},
+  {FN (arctanh_real), 3.45266983001243932001e-04, RES(3.4526699672092216295e-4, 0.0)},
+  {FN (arctanh_real), 1.250e-01, RES(1.2565721414045303884e-1, 0.0)},
+  {FN (arctanh_real), 5.0e-01, RES(5.4930614433405484570e-1, 0.0)},
+  {FN (arctanh_real), 7.50e-01, RES(9.7295507452765665255e-1, 0.0)},
+  {FN (arctanh_real), 2.0e+00, RES(5.4930614433405484570e-1, -1.5707963267948966192e0)},
+  {FN (arctanh_real), 1.0e+01, RES(1.0033534773107558064e-1, -1.5707963267948966192e0)},
+  {FN (arccsc_real), -1.0e+01, RES(-1.0016742116155979635e-1, 0.0)},
+  {FN (arccsc_real), -2.0e+00, RES(-5.2359877559829887308e-1, 0.0)},
+  {FN (arccsc_real), -1.0e+00, RES(-1.5707963267948966192e0, 0.0)},
+  {FN (arccsc_real), -7.50e-01, RES(-1.5707963267948966192e0, 7.9536546122390563053e-1)},
+  {FN (arccsc_real), -5.0e-01, RES(-1.5707963267948966192e0, 1.3169578969248167086e0)},
+  {FN (arccsc_real), -1.250e-01, RES(-1.5707963267948966192e0, 2.7686593833135738327e0)},
+  {FN (arccsc_real), -3.45266983001243932001e-04, RES(-1.5707963267948966192e0, 8.6643397271969925794e0)},
+  {FN (arccsc_real), -1.19209289550781250e-07, RES(-1.5707963267948966192e0, 1.6635532333438683873e1)},
+  {FN (arccsc_real), 1.19209289550781250e-07, RES(1.5707963267948966192e0, -1.6635532333438683873e1)},
+  {FN (arccsc_real), 3.45266983001243932001e-04, RES(1.5707963267948966192e0, -8.6643397271969925794e0)},
+  {FN (arccsc_real), 1.250e-01, RES(1.5707963267948966192e0, -2.7686593833135738327e0)},
+  {FN (arccsc_real), 5.0e-01, RES(1.5707963267948966192e0, -1.3169578969248167086e0)},
+  {FN (arccsc_real), 7.50e-01, RES(1.5707963267948966192e0, -7.9536546122390563053e-1)},
+  {FN (arccsc_real), 1.0e+00, RES(1.5707963267948966192e0, 0.0)},
+  {FN (arccsc_real), 2.0e+00, RES(5.2359877559829887308e-1, 0.0)},
+  {FN (arccsc_real), 1.0e+01, RES(1.0016742116155979635e-1, 0.0)},
+  {FN (arcsec_real), -1.0e+01, RES(1.6709637479564564156e0, 0.0)},
+  {FN (arcsec_real), -2.0e+00, RES(2.0943951023931954923e0, 0.0)},
+  {FN (arcsec_real), -1.0e+00, RES(3.1415926535897932385e0, 0.0)},
+  {FN (arcsec_real), -7.50e-01, RES(3.1415926535897932385e0, -7.9536546122390563053e-1)},
+  {FN (arcsec_real), -5.0e-01, RES(3.1415926535897932385e0, -1.3169578969248167086e0)},
+  {FN (arcsec_real), -1.250e-01, RES(3.1415926535897932385e0, -2.7686593833135738327e0)},
+  {FN (arcsec_real), -3.45266983001243932001e-04, RES(3.1415926535897932385e0, -8.6643397271969925794e0)},
+  {FN (arcsec_real), -1.19209289550781250e-07, RES(3.1415926535897932385e0, -1.6635532333438683873e1)},
+  {FN (arcsec_real), 1.19209289550781250e-07, RES(0, 1.6635532333438683873e1)},
+  {FN (arcsec_real), 3.45266983001243932001e-04, RES(0, 8.6643397271969925794e0)},
+  {FN (arcsec_real), 1.250e-01, RES(0, 2.7686593833135738327e0)},
+  {FN (arcsec_real), 5.0e-01, RES(0, 1.3169578969248167086e0)},
+  {FN (arcsec_real), 7.50e-01, RES(0, 7.9536546122390563053e-1)},
+  {FN (arcsec_real), 1.0e+00, RES(0e0, 0.0)},
+  {FN (arcsec_real), 2.0e+00, RES(1.0471975511965977462e0, 0.0)},
+  {FN (arcsec_real), 1.0e+01, RES(1.4706289056333368229e0, 0.0)},
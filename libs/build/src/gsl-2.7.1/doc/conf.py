@@ -0,0 +1,196 @@
+# -*- coding: utf-8 -*-
+#
+# GSL documentation build configuration file, created by
+# sphinx-quickstart on Mon Feb 27 15:17:27 2017.
+#
+# This file is execfile()d with the current directory set to its
+# containing dir.
+#
+# Note that not all possible configuration values are present in this
+# autogenerated file.
+#
+# All configuration values have a default; values that are commented out
+# serve to show the default.
+
+# If extensions (or modules to document with autodoc) are in another directory,
+# add these directories to sys.path here. If the directory is relative to the
+# documentation root, use os.path.abspath to make it absolute, like shown here.
+#
+# import os
+# import sys
+# sys.path.insert(0, os.path.abspath('.'))
+import sphinx_rtd_theme
+
+
+# -- General configuration ------------------------------------------------
+
+# If your documentation needs a minimal Sphinx version, state it here.
+#
+# needs_sphinx = '1.0'
+
+# Add any Sphinx extension module names here, as strings. They can be
+# extensions coming with Sphinx (named 'sphinx.ext.*') or your custom
+# ones.
+extensions = ['sphinx.ext.imgmath']
+
+# Add any paths that contain templates here, relative to this directory.
+templates_path = ['_templates']
+
+# The suffix(es) of source filenames.
+# You can specify multiple suffix as a list of string:
+#
+# source_suffix = ['.rst', '.md']
+source_suffix = '.rst'
+
+# The master toctree document.
+master_doc = 'index'
+
+# General information about the project.
+project = u'GSL'
+copyright = u'1996-2021 The GSL Team'
+author = u'The GSL Team'
+title = u'GNU Scientific Library'
+
+# The version info for the project you're documenting, acts as replacement for
+# |version| and |release|, also used in various other places throughout the
+# built documents.
+#
+# The short X.Y version.
+version = u'2.7'
+# The full version, including alpha/beta/rc tags.
+release = u'2.7'
+
+primary_domain = 'c'
+numfig = True
+
+# The language for content autogenerated by Sphinx. Refer to documentation
+# for a list of supported languages.
+#
+# This is also used if you do content translation via gettext catalogs.
+# Usually you set "language" from the command line for these cases.
+language = None
+
+# List of patterns, relative to source directory, that match files and
+# directories to ignore when looking for source files.
+# This patterns also effect to html_static_path and html_extra_path
+exclude_patterns = ['_build', 'Thumbs.db', '.DS_Store', 'include.rst', 'specfunc-*.rst']
+
+# The name of the Pygments (syntax highlighting) style to use.
+pygments_style = 'sphinx'
+
+# If true, `todo` and `todoList` produce output, else they produce nothing.
+todo_include_todos = False
+
+
+# -- Options for HTML output ----------------------------------------------
+
+# The theme to use for HTML and HTML Help pages.  See the documentation for
+# a list of builtin themes.
+#
+#html_theme = 'alabaster'
+html_theme = 'sphinx_rtd_theme'
+html_theme_path = [sphinx_rtd_theme.get_html_theme_path()]
+
+# Theme options are theme-specific and customize the look and feel of a theme
+# further.  For a list of options available for each theme, see the
+# documentation.
+#
+html_theme_options = {
+  'display_version': True,
+  'prev_next_buttons_location': 'both'
+}
+
+# Add any paths that contain custom static files (such as style sheets) here,
+# relative to this directory. They are copied after the builtin static files,
+# so a file named "default.css" will overwrite the builtin "default.css".
+html_static_path = ['_static']
+
+
+# -- Options for HTMLHelp output ------------------------------------------
+
+# Output file base name for HTML help builder.
+htmlhelp_basename = 'GSLdoc'
+
+
+# -- Options for LaTeX output ---------------------------------------------
+
+my_latex_preamble = '\\DeclareMathOperator\\arccosh{arccosh} \
+                     \\DeclareMathOperator\\arcsinh{arcsinh} \
+                     \\DeclareMathOperator\\arctanh{arctanh} \
+                     \\DeclareMathOperator\\arcsec{arcsec} \
+                     \\DeclareMathOperator\\arccsc{arccsc} \
+                     \\DeclareMathOperator\\arccot{arccot} \
+                     \\DeclareMathOperator\\csch{csch} \
+                     \\DeclareMathOperator\\sech{sech} \
+                     \\DeclareMathOperator\\arcsech{arcsech} \
+                     \\DeclareMathOperator\\arccsch{arccsch} \
+                     \\DeclareMathOperator\\arccoth{arccoth} \
+                     \\DeclareMathOperator\\erf{erf} \
+                     \\DeclareMathOperator\\erfc{erfc} \
+                     \\DeclareMathOperator\\sgn{sgn} \
+                     \\DeclareMathOperator\\sinc{sinc} \
+                     \\DeclareMathOperator\\Var{Var} \
+                     \\DeclareMathOperator\\diag{diag} \
+                     \\newcommand\\undermat[2]{\\makebox[0pt][l]{$\\smash{\\underbrace{\\phantom{\\begin{matrix}#2\\end{matrix}}}_{\\text{$#1$}}}$}#2}'
+
+my_latex_authors = 'Mark Galassi \\\\ \
+                    Jim Davies \\\\ \
+                    James Theiler \\\\ \
+                    Brian Gough \\\\ \
+                    Gerard Jungman \\\\ \
+                    Patrick Alken \\\\ \
+                    Michael Booth \\\\ \
+                    Fabrice Rossi \\\\ \
+                    Rhys Ulerich'
+
+latex_elements = {
+    # The paper size ('letterpaper' or 'a4paper').
+    #
+    # 'papersize': 'letterpaper',
+
+    # The font size ('10pt', '11pt' or '12pt').
+    #
+    # 'pointsize': '10pt',
+
+    # Additional stuff for the LaTeX preamble.
+    #
+    'preamble': my_latex_preamble,
+
+    # Latex figure (float) alignment
+    #
+    # 'figure_align': 'htbp',
+}
+
+# Grouping the document tree into LaTeX files. List of tuples
+# (source start file, target name, title,
+#  author, documentclass [howto, manual, or own class]).
+latex_documents = [
+    (master_doc, 'gsl-ref.tex', title,
+     my_latex_authors, 'manual'),
+]
+
+imgmath_latex_preamble = my_latex_preamble
+
+
+# -- Options for manual page output ---------------------------------------
+
+# One entry per manual page. List of tuples
+# (source start file, name, description, authors, manual section).
+man_pages = [
+    (master_doc, 'gsl', title,
+     [author], 1)
+]
+
+
+# -- Options for Texinfo output -------------------------------------------
+
+# Grouping the document tree into Texinfo files. List of tuples
+# (source start file, target name, title, author,
+#  dir menu entry, description, category)
+texinfo_documents = [
+    (master_doc, 'gsl-ref', title,
+     author, 'GSL', 'One line description of project.',
+     'Miscellaneous'),
+]
+
+
@@ -0,0 +1,22 @@
+#include <stdio.h>
+#include <gsl/gsl_vector.h>
+
+int
+main (void)
+{
+  int i;
+  gsl_vector * v = gsl_vector_alloc (3);
+  
+  for (i = 0; i < 3; i++)
+    {
+      gsl_vector_set (v, i, 1.23 + i);
+    }
+  
+  for (i = 0; i < 100; i++) /* OUT OF RANGE ERROR */
+    {
+      printf ("v_%d = %g\n", i, gsl_vector_get (v, i));
+    }
+
+  gsl_vector_free (v);
+  return 0;
+}
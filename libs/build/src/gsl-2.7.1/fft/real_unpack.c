@@ -0,0 +1,42 @@
+/* fft/real_unpack.c
+ * 
+ * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007 Brian Gough
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include "complex_internal.h"
+
+int
+FUNCTION(gsl_fft_real,unpack) (const BASE real_coefficient[],
+                               BASE complex_coefficient[],
+                               const size_t stride, const size_t n)
+{
+  size_t i;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      REAL(complex_coefficient,stride,i) = real_coefficient[i * stride];
+      IMAG(complex_coefficient,stride,i) = 0.0;
+    }
+
+  return 0;
+
+}
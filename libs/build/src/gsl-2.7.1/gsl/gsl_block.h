@@ -0,0 +1 @@
+../block/gsl_block.h
\ No newline at end of file
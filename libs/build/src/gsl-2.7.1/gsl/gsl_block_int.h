@@ -0,0 +1 @@
+../block/gsl_block_int.h
\ No newline at end of file
@@ -0,0 +1 @@
+../block/gsl_block_long_double.h
\ No newline at end of file
@@ -0,0 +1 @@
+../block/gsl_block_ulong.h
\ No newline at end of file
@@ -0,0 +1 @@
+../bspline/gsl_bspline.h
\ No newline at end of file
@@ -0,0 +1 @@
+../bst/gsl_bst.h
\ No newline at end of file
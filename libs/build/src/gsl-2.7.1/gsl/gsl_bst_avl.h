@@ -0,0 +1 @@
+../bst/gsl_bst_avl.h
\ No newline at end of file
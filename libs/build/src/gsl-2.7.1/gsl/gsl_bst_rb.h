@@ -0,0 +1 @@
+../bst/gsl_bst_rb.h
\ No newline at end of file
@@ -0,0 +1 @@
+../bst/gsl_bst_types.h
\ No newline at end of file
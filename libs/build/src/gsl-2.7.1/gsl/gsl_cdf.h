@@ -0,0 +1 @@
+../cdf/gsl_cdf.h
\ No newline at end of file
@@ -0,0 +1 @@
+../cheb/gsl_chebyshev.h
\ No newline at end of file
@@ -0,0 +1 @@
+../block/gsl_check_range.h
\ No newline at end of file
@@ -0,0 +1 @@
+../combination/gsl_combination.h
\ No newline at end of file
@@ -0,0 +1 @@
+../complex/gsl_complex.h
\ No newline at end of file
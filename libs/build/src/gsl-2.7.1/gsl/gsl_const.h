@@ -0,0 +1 @@
+../const/gsl_const.h
\ No newline at end of file
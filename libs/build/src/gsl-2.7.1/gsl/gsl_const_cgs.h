@@ -0,0 +1 @@
+../const/gsl_const_cgs.h
\ No newline at end of file
@@ -0,0 +1 @@
+../const/gsl_const_cgsm.h
\ No newline at end of file
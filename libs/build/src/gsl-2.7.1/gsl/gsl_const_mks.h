@@ -0,0 +1 @@
+../const/gsl_const_mks.h
\ No newline at end of file
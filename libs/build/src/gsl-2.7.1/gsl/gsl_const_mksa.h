@@ -0,0 +1 @@
+../const/gsl_const_mksa.h
\ No newline at end of file
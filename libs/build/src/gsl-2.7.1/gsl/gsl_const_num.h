@@ -0,0 +1 @@
+../const/gsl_const_num.h
\ No newline at end of file
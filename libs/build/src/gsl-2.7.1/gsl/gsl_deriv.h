@@ -0,0 +1 @@
+../deriv/gsl_deriv.h
\ No newline at end of file
@@ -0,0 +1 @@
+../fft/gsl_dft_complex.h
\ No newline at end of file
@@ -0,0 +1 @@
+../fft/gsl_dft_complex_float.h
\ No newline at end of file
@@ -0,0 +1 @@
+../dht/gsl_dht.h
\ No newline at end of file
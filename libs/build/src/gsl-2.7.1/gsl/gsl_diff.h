@@ -0,0 +1 @@
+../diff/gsl_diff.h
\ No newline at end of file
@@ -0,0 +1 @@
+../fft/gsl_fft.h
\ No newline at end of file
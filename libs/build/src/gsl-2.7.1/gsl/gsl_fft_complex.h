@@ -0,0 +1 @@
+../fft/gsl_fft_complex.h
\ No newline at end of file
@@ -0,0 +1 @@
+../fft/gsl_fft_halfcomplex.h
\ No newline at end of file
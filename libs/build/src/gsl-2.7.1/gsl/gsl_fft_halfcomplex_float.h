@@ -0,0 +1 @@
+../fft/gsl_fft_halfcomplex_float.h
\ No newline at end of file
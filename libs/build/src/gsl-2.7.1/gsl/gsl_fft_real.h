@@ -0,0 +1 @@
+../fft/gsl_fft_real.h
\ No newline at end of file
@@ -0,0 +1 @@
+../fft/gsl_fft_real_float.h
\ No newline at end of file
@@ -0,0 +1 @@
+../filter/gsl_filter.h
\ No newline at end of file
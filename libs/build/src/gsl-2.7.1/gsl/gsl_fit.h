@@ -0,0 +1 @@
+../fit/gsl_fit.h
\ No newline at end of file
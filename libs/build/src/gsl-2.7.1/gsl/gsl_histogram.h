@@ -0,0 +1 @@
+../histogram/gsl_histogram.h
\ No newline at end of file
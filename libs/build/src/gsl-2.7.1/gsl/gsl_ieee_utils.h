@@ -0,0 +1 @@
+../ieee-utils/gsl_ieee_utils.h
\ No newline at end of file
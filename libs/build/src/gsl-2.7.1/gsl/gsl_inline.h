@@ -0,0 +1 @@
+../gsl_inline.h
\ No newline at end of file
@@ -0,0 +1 @@
+../interpolation/gsl_interp.h
\ No newline at end of file
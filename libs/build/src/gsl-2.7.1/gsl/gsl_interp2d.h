@@ -0,0 +1 @@
+../interpolation/gsl_interp2d.h
\ No newline at end of file
@@ -0,0 +1 @@
+../linalg/gsl_linalg.h
\ No newline at end of file
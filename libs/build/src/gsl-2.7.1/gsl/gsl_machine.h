@@ -0,0 +1 @@
+../gsl_machine.h
\ No newline at end of file
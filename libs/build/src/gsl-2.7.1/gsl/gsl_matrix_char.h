@@ -0,0 +1 @@
+../matrix/gsl_matrix_char.h
\ No newline at end of file
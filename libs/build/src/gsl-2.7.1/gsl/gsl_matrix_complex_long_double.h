@@ -0,0 +1 @@
+../matrix/gsl_matrix_complex_long_double.h
\ No newline at end of file
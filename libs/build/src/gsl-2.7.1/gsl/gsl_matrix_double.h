@@ -0,0 +1 @@
+../matrix/gsl_matrix_double.h
\ No newline at end of file
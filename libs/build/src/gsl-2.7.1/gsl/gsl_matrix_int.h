@@ -0,0 +1 @@
+../matrix/gsl_matrix_int.h
\ No newline at end of file
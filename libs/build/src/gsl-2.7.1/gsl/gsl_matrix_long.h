@@ -0,0 +1 @@
+../matrix/gsl_matrix_long.h
\ No newline at end of file
@@ -0,0 +1 @@
+../matrix/gsl_matrix_ushort.h
\ No newline at end of file
@@ -0,0 +1 @@
+../min/gsl_min.h
\ No newline at end of file
@@ -0,0 +1 @@
+../gsl_minmax.h
\ No newline at end of file
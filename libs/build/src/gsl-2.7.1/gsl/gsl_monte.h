@@ -0,0 +1 @@
+../monte/gsl_monte.h
\ No newline at end of file
@@ -0,0 +1 @@
+../monte/gsl_monte_miser.h
\ No newline at end of file
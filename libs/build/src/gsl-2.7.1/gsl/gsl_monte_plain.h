@@ -0,0 +1 @@
+../monte/gsl_monte_plain.h
\ No newline at end of file
@@ -0,0 +1 @@
+../monte/gsl_monte_vegas.h
\ No newline at end of file
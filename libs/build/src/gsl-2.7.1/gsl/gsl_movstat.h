@@ -0,0 +1 @@
+../movstat/gsl_movstat.h
\ No newline at end of file
@@ -0,0 +1 @@
+../multifit/gsl_multifit.h
\ No newline at end of file
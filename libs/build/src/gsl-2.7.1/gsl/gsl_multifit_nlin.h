@@ -0,0 +1 @@
+../multifit/gsl_multifit_nlin.h
\ No newline at end of file
@@ -0,0 +1 @@
+../multifit_nlinear/gsl_multifit_nlinear.h
\ No newline at end of file
@@ -0,0 +1 @@
+../multilarge/gsl_multilarge.h
\ No newline at end of file
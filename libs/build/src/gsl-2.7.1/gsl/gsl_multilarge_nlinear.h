@@ -0,0 +1 @@
+../multilarge_nlinear/gsl_multilarge_nlinear.h
\ No newline at end of file
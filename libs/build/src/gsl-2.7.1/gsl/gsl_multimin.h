@@ -0,0 +1 @@
+../multimin/gsl_multimin.h
\ No newline at end of file
@@ -0,0 +1 @@
+../multiroots/gsl_multiroots.h
\ No newline at end of file
@@ -0,0 +1 @@
+../multiset/gsl_multiset.h
\ No newline at end of file
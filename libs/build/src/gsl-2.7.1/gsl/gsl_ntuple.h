@@ -0,0 +1 @@
+../ntuple/gsl_ntuple.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ode-initval/gsl_odeiv.h
\ No newline at end of file
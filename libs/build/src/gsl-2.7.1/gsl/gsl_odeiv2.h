@@ -0,0 +1 @@
+../ode-initval2/gsl_odeiv2.h
\ No newline at end of file
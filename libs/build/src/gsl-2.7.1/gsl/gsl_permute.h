@@ -0,0 +1 @@
+../permutation/gsl_permute.h
\ No newline at end of file
@@ -0,0 +1 @@
+../permutation/gsl_permute_char.h
\ No newline at end of file
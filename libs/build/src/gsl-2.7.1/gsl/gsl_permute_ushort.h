@@ -0,0 +1 @@
+../permutation/gsl_permute_ushort.h
\ No newline at end of file
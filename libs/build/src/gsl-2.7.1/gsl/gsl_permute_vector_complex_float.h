@@ -0,0 +1 @@
+../permutation/gsl_permute_vector_complex_float.h
\ No newline at end of file
@@ -0,0 +1 @@
+../permutation/gsl_permute_vector_long_double.h
\ No newline at end of file
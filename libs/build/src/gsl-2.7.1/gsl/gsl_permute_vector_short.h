@@ -0,0 +1 @@
+../permutation/gsl_permute_vector_short.h
\ No newline at end of file
@@ -0,0 +1 @@
+../gsl_pow_int.h
\ No newline at end of file
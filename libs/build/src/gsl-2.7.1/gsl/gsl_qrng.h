@@ -0,0 +1 @@
+../qrng/gsl_qrng.h
\ No newline at end of file
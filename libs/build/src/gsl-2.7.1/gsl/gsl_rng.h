@@ -0,0 +1 @@
+../rng/gsl_rng.h
\ No newline at end of file
@@ -0,0 +1 @@
+../roots/gsl_roots.h
\ No newline at end of file
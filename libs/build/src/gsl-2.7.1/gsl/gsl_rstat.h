@@ -0,0 +1 @@
+../rstat/gsl_rstat.h
\ No newline at end of file
@@ -0,0 +1 @@
+../specfunc/gsl_sf.h
\ No newline at end of file
@@ -0,0 +1 @@
+../specfunc/gsl_sf_dilog.h
\ No newline at end of file
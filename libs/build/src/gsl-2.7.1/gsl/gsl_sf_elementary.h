@@ -0,0 +1 @@
+../specfunc/gsl_sf_elementary.h
\ No newline at end of file
@@ -0,0 +1 @@
+../specfunc/gsl_sf_elljac.h
\ No newline at end of file
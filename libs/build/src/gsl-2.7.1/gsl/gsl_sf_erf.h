@@ -0,0 +1 @@
+../specfunc/gsl_sf_erf.h
\ No newline at end of file
@@ -0,0 +1 @@
+../specfunc/gsl_sf_exp.h
\ No newline at end of file
@@ -0,0 +1 @@
+../specfunc/gsl_sf_expint.h
\ No newline at end of file
@@ -0,0 +1 @@
+../specfunc/gsl_sf_hermite.h
\ No newline at end of file
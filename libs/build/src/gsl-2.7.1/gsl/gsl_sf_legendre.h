@@ -0,0 +1 @@
+../specfunc/gsl_sf_legendre.h
\ No newline at end of file
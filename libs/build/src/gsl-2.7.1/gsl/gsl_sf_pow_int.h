@@ -0,0 +1 @@
+../specfunc/gsl_sf_pow_int.h
\ No newline at end of file
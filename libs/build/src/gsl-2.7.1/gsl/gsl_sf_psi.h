@@ -0,0 +1 @@
+../specfunc/gsl_sf_psi.h
\ No newline at end of file
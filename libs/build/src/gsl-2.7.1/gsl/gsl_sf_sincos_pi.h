@@ -0,0 +1 @@
+../specfunc/gsl_sf_sincos_pi.h
\ No newline at end of file
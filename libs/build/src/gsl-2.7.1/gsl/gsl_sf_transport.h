@@ -0,0 +1 @@
+../specfunc/gsl_sf_transport.h
\ No newline at end of file
@@ -0,0 +1 @@
+../specfunc/gsl_sf_trig.h
\ No newline at end of file
@@ -0,0 +1 @@
+../specfunc/gsl_sf_zeta.h
\ No newline at end of file
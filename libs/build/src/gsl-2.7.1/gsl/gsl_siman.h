@@ -0,0 +1 @@
+../siman/gsl_siman.h
\ No newline at end of file
@@ -0,0 +1 @@
+../sort/gsl_sort_double.h
\ No newline at end of file
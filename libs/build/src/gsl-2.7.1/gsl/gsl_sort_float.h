@@ -0,0 +1 @@
+../sort/gsl_sort_float.h
\ No newline at end of file
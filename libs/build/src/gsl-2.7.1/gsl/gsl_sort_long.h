@@ -0,0 +1 @@
+../sort/gsl_sort_long.h
\ No newline at end of file
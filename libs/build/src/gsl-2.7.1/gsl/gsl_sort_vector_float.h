@@ -0,0 +1 @@
+../sort/gsl_sort_vector_float.h
\ No newline at end of file
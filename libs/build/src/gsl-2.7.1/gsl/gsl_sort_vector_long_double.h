@@ -0,0 +1 @@
+../sort/gsl_sort_vector_long_double.h
\ No newline at end of file
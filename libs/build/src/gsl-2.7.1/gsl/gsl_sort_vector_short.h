@@ -0,0 +1 @@
+../sort/gsl_sort_vector_short.h
\ No newline at end of file
@@ -0,0 +1 @@
+../spblas/gsl_spblas.h
\ No newline at end of file
@@ -0,0 +1 @@
+../specfunc/gsl_specfunc.h
\ No newline at end of file
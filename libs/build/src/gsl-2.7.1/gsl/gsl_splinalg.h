@@ -0,0 +1 @@
+../splinalg/gsl_splinalg.h
\ No newline at end of file
@@ -0,0 +1 @@
+../interpolation/gsl_spline.h
\ No newline at end of file
@@ -0,0 +1 @@
+../interpolation/gsl_spline2d.h
\ No newline at end of file
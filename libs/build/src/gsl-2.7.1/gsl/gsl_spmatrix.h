@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix.h
\ No newline at end of file
@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_char.h
\ No newline at end of file
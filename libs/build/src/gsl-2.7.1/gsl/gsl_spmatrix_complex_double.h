@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_complex_double.h
\ No newline at end of file
@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_complex_float.h
\ No newline at end of file
@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_float.h
\ No newline at end of file
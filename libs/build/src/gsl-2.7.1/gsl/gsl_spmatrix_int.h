@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_int.h
\ No newline at end of file
@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_long.h
\ No newline at end of file
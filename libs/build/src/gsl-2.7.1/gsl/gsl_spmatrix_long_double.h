@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_long_double.h
\ No newline at end of file
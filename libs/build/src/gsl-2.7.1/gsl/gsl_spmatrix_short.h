@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_short.h
\ No newline at end of file
@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_uchar.h
\ No newline at end of file
@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_uint.h
\ No newline at end of file
@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_ulong.h
\ No newline at end of file
@@ -0,0 +1 @@
+../spmatrix/gsl_spmatrix_ushort.h
\ No newline at end of file
@@ -0,0 +1 @@
+../statistics/gsl_statistics.h
\ No newline at end of file
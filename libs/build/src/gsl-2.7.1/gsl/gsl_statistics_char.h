@@ -0,0 +1 @@
+../statistics/gsl_statistics_char.h
\ No newline at end of file
@@ -0,0 +1 @@
+../statistics/gsl_statistics_int.h
\ No newline at end of file
@@ -0,0 +1 @@
+../statistics/gsl_statistics_long_double.h
\ No newline at end of file
@@ -0,0 +1 @@
+../statistics/gsl_statistics_uchar.h
\ No newline at end of file
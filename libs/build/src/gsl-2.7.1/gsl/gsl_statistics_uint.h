@@ -0,0 +1 @@
+../statistics/gsl_statistics_uint.h
\ No newline at end of file
@@ -0,0 +1 @@
+../sum/gsl_sum.h
\ No newline at end of file
@@ -0,0 +1 @@
+../gsl_types.h
\ No newline at end of file
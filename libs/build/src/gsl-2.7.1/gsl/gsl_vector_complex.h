@@ -0,0 +1 @@
+../vector/gsl_vector_complex.h
\ No newline at end of file
@@ -0,0 +1 @@
+../vector/gsl_vector_int.h
\ No newline at end of file
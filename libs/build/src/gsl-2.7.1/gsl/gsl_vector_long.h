@@ -0,0 +1 @@
+../vector/gsl_vector_long.h
\ No newline at end of file
@@ -0,0 +1 @@
+../vector/gsl_vector_uchar.h
\ No newline at end of file
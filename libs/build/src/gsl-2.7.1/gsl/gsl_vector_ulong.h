@@ -0,0 +1 @@
+../vector/gsl_vector_ulong.h
\ No newline at end of file
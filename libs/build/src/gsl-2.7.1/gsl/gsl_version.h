@@ -0,0 +1 @@
+../gsl_version.h
\ No newline at end of file
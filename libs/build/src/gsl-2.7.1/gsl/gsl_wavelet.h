@@ -0,0 +1 @@
+../wavelet/gsl_wavelet.h
\ No newline at end of file
@@ -0,0 +1 @@
+../wavelet/gsl_wavelet2d.h
\ No newline at end of file
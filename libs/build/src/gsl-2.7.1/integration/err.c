@@ -0,0 +1,58 @@
+/* integration/err.c
+ * 
+ * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007 Brian Gough
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <math.h>
+#include <float.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_integration.h>
+
+static double rescale_error (double err, const double result_abs, const double result_asc) ;
+
+static double
+rescale_error (double err, const double result_abs, const double result_asc)
+{
+  err = fabs(err) ;
+
+  if (result_asc != 0 && err != 0)
+      {
+        double scale = pow((200 * err / result_asc), 1.5) ;
+        
+        if (scale < 1)
+          {
+            err = result_asc * scale ;
+          }
+        else 
+          {
+            err = result_asc ;
+          }
+      }
+  if (result_abs > GSL_DBL_MIN / (50 * GSL_DBL_EPSILON))
+    {
+      double min_err = 50 * GSL_DBL_EPSILON * result_abs ;
+
+      if (min_err > err) 
+        {
+          err = min_err ;
+        }
+    }
+  
+  return err ;
+}
+
@@ -0,0 +1,154 @@
+/* integration/workspace.c
+ * 
+ * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007, 2009 Brian Gough
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_integration.h>
+#include <gsl/gsl_errno.h>
+
+gsl_integration_workspace *
+gsl_integration_workspace_alloc (const size_t n) 
+{
+  gsl_integration_workspace * w ;
+  
+  if (n == 0)
+    {
+      GSL_ERROR_VAL ("workspace length n must be positive integer",
+                        GSL_EDOM, 0);
+    }
+
+  w = (gsl_integration_workspace *) 
+    malloc (sizeof (gsl_integration_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for workspace struct",
+                        GSL_ENOMEM, 0);
+    }
+
+  w->alist = (double *) malloc (n * sizeof (double));
+
+  if (w->alist == 0)
+    {
+      free (w);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for alist ranges",
+                        GSL_ENOMEM, 0);
+    }
+
+  w->blist = (double *) malloc (n * sizeof (double));
+
+  if (w->blist == 0)
+    {
+      free (w->alist);
+      free (w);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for blist ranges",
+                        GSL_ENOMEM, 0);
+    }
+
+  w->rlist = (double *) malloc (n * sizeof (double));
+
+  if (w->rlist == 0)
+    {
+      free (w->blist);
+      free (w->alist);
+      free (w);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for rlist ranges",
+                        GSL_ENOMEM, 0);
+    }
+
+
+  w->elist = (double *) malloc (n * sizeof (double));
+
+  if (w->elist == 0)
+    {
+      free (w->rlist);
+      free (w->blist);
+      free (w->alist);
+      free (w);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for elist ranges",
+                        GSL_ENOMEM, 0);
+    }
+
+  w->order = (size_t *) malloc (n * sizeof (size_t));
+
+  if (w->order == 0)
+    {
+      free (w->elist);
+      free (w->rlist);
+      free (w->blist);
+      free (w->alist);
+      free (w);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for order ranges",
+                        GSL_ENOMEM, 0);
+    }
+
+  w->level = (size_t *) malloc (n * sizeof (size_t));
+
+  if (w->level == 0)
+    {
+      free (w->order);
+      free (w->elist);
+      free (w->rlist);
+      free (w->blist);
+      free (w->alist);
+      free (w);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for order ranges",
+                        GSL_ENOMEM, 0);
+    }
+
+  w->size = 0 ;
+  w->limit = n ;
+  w->maximum_level = 0 ;
+  
+  return w ;
+}
+
+void
+gsl_integration_workspace_free (gsl_integration_workspace * w)
+{
+  RETURN_IF_NULL (w);
+  free (w->level) ;
+  free (w->order) ;
+  free (w->elist) ;
+  free (w->rlist) ;
+  free (w->blist) ;
+  free (w->alist) ;
+  free (w) ;
+}
+
+/*
+size_t 
+gsl_integration_workspace_limit (gsl_integration_workspace * w) 
+{
+  return w->limit ;
+}
+
+
+size_t 
+gsl_integration_workspace_size (gsl_integration_workspace * w) 
+{
+  return w->size ;
+}
+*/
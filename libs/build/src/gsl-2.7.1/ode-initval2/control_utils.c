@@ -0,0 +1,29 @@
+/* ode-initval2/control_utils.c
+ * 
+ * Copyright (C) 2009 Tuomo Keskitalo
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+static int
+control_set_driver_null (void *vstate, const gsl_odeiv2_driver * d)
+{
+  /* Dummy set function for those control objects that do not
+     need pointer to driver object. */
+  (void) vstate;
+  (void) d;
+
+  return GSL_SUCCESS;
+}
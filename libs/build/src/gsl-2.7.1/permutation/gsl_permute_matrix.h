@@ -0,0 +1,24 @@
+#ifndef __GSL_PERMUTE_MATRIX_H__
+#define __GSL_PERMUTE_MATRIX_H__
+
+#include <gsl/gsl_permute_matrix_complex_long_double.h>
+#include <gsl/gsl_permute_matrix_complex_double.h>
+#include <gsl/gsl_permute_matrix_complex_float.h>
+
+#include <gsl/gsl_permute_matrix_long_double.h>
+#include <gsl/gsl_permute_matrix_double.h>
+#include <gsl/gsl_permute_matrix_float.h>
+
+#include <gsl/gsl_permute_matrix_ulong.h>
+#include <gsl/gsl_permute_matrix_long.h>
+
+#include <gsl/gsl_permute_matrix_uint.h>
+#include <gsl/gsl_permute_matrix_int.h>
+
+#include <gsl/gsl_permute_matrix_ushort.h>
+#include <gsl/gsl_permute_matrix_short.h>
+
+#include <gsl/gsl_permute_matrix_uchar.h>
+#include <gsl/gsl_permute_matrix_char.h>
+
+#endif /* __GSL_PERMUTE_MATRIX_H__ */
@@ -0,0 +1,38 @@
+/* specfunc/bessel_temme.h
+ * 
+ * Copyright (C) 1996, 1997, 1998, 1999, 2000 Gerard Jungman
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Author:  G. Jungman */
+
+#ifndef BESSEL_TEMME_H_
+#define BESSEL_TEMME_H_
+
+#include <gsl/gsl_sf_result.h>
+
+
+int
+gsl_sf_bessel_Y_temme(const double nu, const double x,
+                      gsl_sf_result * Y_nu,
+                      gsl_sf_result * Y_nup1);
+
+int
+gsl_sf_bessel_K_scaled_temme(const double nu, const double x,
+                             double * K_nu, double * K_nup1, double * Kp_nu);
+
+
+#endif /* !BESSEL_TEMME_H_ */
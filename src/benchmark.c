@@ -0,0 +1,417 @@
+/*
+  This file is part of JURASSIC.
+
+  JURASSIC is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  JURASSIC is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with JURASSIC. If not, see <http://www.gnu.org/licenses/>.
+
+  Copyright (C) 2003-2025 Forschungszentrum Juelich GmbH
+*/
+
+/*!
+  \file
+  Micro-benchmarks for the core kernels of the forward model and retrieval,
+  and for loading ASCII data files.
+*/
+
+#include <gsl/gsl_sort.h>
+#include "jurassic.h"
+
+/* ------------------------------------------------------------
+   Dimensions...
+   ------------------------------------------------------------ */
+
+/*! Maximum number of repetitions. */
+#define NREP 1000
+
+/* ------------------------------------------------------------
+   Macros...
+   ------------------------------------------------------------ */
+
+/*! Run code block repeatedly (after one warm-up run) and write timings. */
+#define BENCH(out, name, nop, ...) {					\
+    double t_rep[NREP];							\
+    for (int irep = -1; irep < nrep; irep++) {				\
+      const double t_start = omp_get_wtime();				\
+      __VA_ARGS__;							\
+      if (irep >= 0)							\
+	t_rep[irep] = omp_get_wtime() - t_start;			\
+    }									\
+    report(out, name, nop, t_rep, nrep);				\
+  }
+
+/* ------------------------------------------------------------
+   Functions...
+   ------------------------------------------------------------ */
+
+/*! Interpolate emissivity tables repeatedly along a line of sight. */
+void intpol_los(
+  const ctl_t * ctl,
+  const tbl_t * tbl,
+  const los_t * los,
+  const int nsweep,
+  const int ega);
+
+/*! Get log-uniform random number. */
+double ran_log(
+  const gsl_rng * rng,
+  const double x0,
+  const double x1);
+
+/*! Get statistics of timings and write results. */
+void report(
+  FILE * out,
+  const char *name,
+  const int nop,
+  double *t_rep,
+  const int nrep);
+
+/* ------------------------------------------------------------
+   Main...
+   ------------------------------------------------------------ */
+
+int main(
+  int argc,
+  char *argv[]) {
+
+  static atm_t atm, atm_i, atm_true, atm_asc;
+  static ctl_t ctl, ctl_asc;
+  static los_t los;
+  static obs_t obs, obs_i, obs_fov, obs_meas, obs_asc;
+  static ret_t ret;
+
+  FILE *out;
+
+  double chisq;
+
+  /* Check arguments... */
+  if (argc < 3)
+    ERRMSG("Give parameters: <ctl> <bench.tab>");
+
+  /* Read control parameters... */
+  read_ctl(argc, argv, &ctl);
+  read_ret(argc, argv, &ctl, &ret);
+  const int nrep = (int) scan_ctl(argc, argv, "NREP", -1, "11", NULL);
+  const int n = (int) scan_ctl(argc, argv, "NSAMPLE", -1, "100000", NULL);
+  const int nsweep = (int) scan_ctl(argc, argv, "NSWEEP", -1, "20", NULL);
+  const double obsz = scan_ctl(argc, argv, "OBSZ", -1, "780", NULL);
+  const double z0 = scan_ctl(argc, argv, "Z0", -1, "3", NULL);
+  const double z1 = scan_ctl(argc, argv, "Z1", -1, "68", NULL);
+  const double dz = scan_ctl(argc, argv, "DZ", -1, "1", NULL);
+  if (nrep < 1 || nrep > NREP)
+    ERRMSG("NREP out of range!");
+  if (n < 1 || nsweep < 1)
+    ERRMSG("NSAMPLE and NSWEEP must be positive!");
+
+  /* Write output to directory of result file... */
+  sprintf(ret.dir, "%s", argv[2]);
+  char *slash = strrchr(ret.dir, '/');
+  if (slash != NULL)
+    *slash = '\0';
+  else
+    sprintf(ret.dir, ".");
+
+  /* Initialize look-up tables... */
+  tbl_t *tbl = read_tbl(&ctl);
+
+  /* Create synthetic climatology... */
+  for (double z = 0; z <= 90; z += 1) {
+    alloc_atm(&ctl, &atm, atm.np + 1);
+    atm.z[atm.np] = z;
+    atm.np++;
+  }
+  climatology(&ctl, &atm);
+
+  /* Create limb geometry... */
+  for (double z = z0; z <= z1; z += dz) {
+    alloc_obs(&ctl, &obs, obs.nr + 1);
+    obs.obsz[obs.nr] = obsz;
+    obs.vpz[obs.nr] = z;
+    obs.vplat[obs.nr] = 180 / M_PI * acos((RE + z) / (RE + obsz));
+    obs.nr++;
+  }
+
+  /* Get dimensions of state and measurement vector... */
+  const size_t nx = atm2x(&ctl, &atm, NULL, NULL, NULL);
+  const size_t ny = obs2y(&ctl, &obs, NULL, NULL, NULL);
+  if (nx == 0 || ny == 0)
+    ERRMSG("Check problem definition!");
+
+  /* Write info... */
+  LOG(1, "Benchmark: %d threads, %d repetitions, %d rays, %zu x %zu kernel",
+      omp_get_max_threads(), nrep, obs.nr, ny, nx);
+
+  /* Initialize random number generator with fixed seed... */
+  gsl_rng *rng = gsl_rng_alloc(gsl_rng_mt19937);
+  gsl_rng_set(rng, 42);
+
+  /* Allocate... */
+  double *x, *y, *p, *t, *u;
+  int *ig, *id, *ip, *it;
+  ALLOC(x, double,
+	n);
+  ALLOC(y, double,
+	n);
+  ALLOC(p, double,
+	n);
+  ALLOC(t, double,
+	n);
+  ALLOC(u, double,
+	n);
+  ALLOC(ig, int,
+	n);
+  ALLOC(id, int,
+	n);
+  ALLOC(ip, int,
+	n);
+  ALLOC(it, int,
+	n);
+
+  /* Draw random samples of table indices and atmospheric conditions... */
+  for (int i = 0; i < n; i++) {
+    int ntry = 0;
+    do {
+      ig[i] = (int) gsl_rng_uniform_int(rng, (unsigned long) ctl.ng);
+      id[i] = (int) gsl_rng_uniform_int(rng, (unsigned long) ctl.nd);
+      if ((++ntry) > 1000)
+	ERRMSG("Missing emissivity tables!");
+    } while (tbl->np[id[i]][ig[i]] < 1);
+    ip[i] = (int) gsl_rng_uniform_int(rng,
+				      (unsigned long) tbl->np[id[i]][ig[i]]);
+    it[i] = (int) gsl_rng_uniform_int(rng, (unsigned long)
+				      tbl->nt[id[i]][ig[i]][ip[i]]);
+    p[i] = ran_log(rng, 0.01, 1000);
+    t[i] = gsl_ran_flat(rng, 180, 320);
+    u[i] = ran_log(rng, 1e16, 1e24);
+    y[i] = 0;
+  }
+
+  /* Create output file... */
+  LOG(1, "Write benchmark results: %s", argv[2]);
+  if (!(out = fopen(argv[2], "w")))
+    ERRMSG("Cannot create file!");
+
+  /* Write header... */
+  fprintf(out,
+	  "# $1 = benchmark name\n"
+	  "# $2 = operations per repetition\n"
+	  "# $3 = number of repetitions\n"
+	  "# $4 = median time per operation [ns]\n"
+	  "# $5 = minimum time per operation [ns]\n"
+	  "# $6 = median throughput [operations/s]\n\n");
+
+  /* Benchmark locate_irr()... */
+  for (int i = 0; i < n; i++)
+    x[i] = gsl_ran_flat(rng, atm.z[0], atm.z[atm.np - 1]);
+  BENCH(out, "locate_irr", n, for (int i = 0; i < n; i++)
+	y[i] = locate_irr(atm.z, atm.np, x[i]));
+
+  /* Benchmark locate_tbl()... */
+  for (int i = 0; i < n; i++)
+    x[i] = ran_log(rng, tbl->u[id[i]][ig[i]][ip[i]][it[i]][0],
+		   tbl->u[id[i]][ig[i]][ip[i]][it[i]]
+		   [tbl->nu[id[i]][ig[i]][ip[i]][it[i]] - 1]);
+  BENCH(out, "locate_tbl", n, for (int i = 0; i < n; i++)
+	y[i] = locate_tbl(tbl->u[id[i]][ig[i]][ip[i]][it[i]],
+			  tbl->nu[id[i]][ig[i]][ip[i]][it[i]], x[i]));
+
+  /* Benchmark intpol_tbl_eps() (within the range of each table)... */
+  BENCH(out, "intpol_tbl_eps", n, for (int i = 0; i < n; i++)
+	y[i] = intpol_tbl_eps(tbl, ig[i], id[i], ip[i], it[i],
+			      (real_t) x[i]));
+
+  /* Benchmark intpol_tbl_u()... */
+  for (int i = 0; i < n; i++)
+    x[i] = gsl_ran_flat(rng, 0, 1);
+  BENCH(out, "intpol_tbl_u", n, for (int i = 0; i < n; i++)
+	y[i] = intpol_tbl_u(tbl, ig[i], id[i], ip[i], it[i], (real_t) x[i]));
+
+  /* Benchmark CO2 and H2O continua (at first channel)... */
+  const double nu = ctl.nu[0];
+  BENCH(out, "ctmco2", n, for (int i = 0; i < n; i++)
+	y[i] = ctmco2(nu, p[i], t[i], u[i]));
+  BENCH(out, "ctmh2o", n, for (int i = 0; i < n; i++)
+	y[i] = ctmh2o(nu, p[i], t[i], 1e-3, u[i]));
+
+  /* Benchmark collision-induced continua (within their own bands)... */
+  for (int i = 0; i < n; i++)
+    x[i] = gsl_ran_flat(rng, 2120, 2605);
+  BENCH(out, "ctmn2", n, for (int i = 0; i < n; i++)
+	y[i] = ctmn2(x[i], p[i], t[i]));
+  for (int i = 0; i < n; i++)
+    x[i] = gsl_ran_flat(rng, 1360, 1805);
+  BENCH(out, "ctmo2", n, for (int i = 0; i < n; i++)
+	y[i] = ctmo2(x[i], p[i], t[i]));
+
+  /* Benchmark raytrace()... */
+  BENCH(out, "raytrace", obs.nr, for (int ir = 0; ir < obs.nr; ir++)
+	raytrace(&ctl, &atm, &obs, &los, ir));
+
+  /* Benchmark table interpolation along a single ray... */
+  raytrace(&ctl, &atm, &obs, &los, obs.nr / 2);
+  const int nlos = los.np * nsweep;
+  BENCH(out, "intpol_tbl_cga", nlos,
+	intpol_los(&ctl, tbl, &los, nsweep, 0));
+  BENCH(out, "intpol_tbl_ega", nlos,
+	intpol_los(&ctl, tbl, &los, nsweep, 1));
+
+  /* Benchmark formod_pencil()... */
+  BENCH(out, "formod_pencil", obs.nr, for (int ir = 0; ir < obs.nr; ir++)
+	formod_pencil(&ctl, tbl, &atm, &obs, ir));
+
+  /* Benchmark formod_fov()... */
+  if (ctl.fov[0] != '-') {
+    copy_obs(&ctl, &obs_fov, &obs, 0);
+    BENCH(out, "formod_fov", obs.nr, formod_fov(&ctl, &obs_fov));
+  } else
+    WARN("Set FOV to benchmark formod_fov()!");
+
+  /* Benchmark kernel()... */
+  gsl_matrix *k = gsl_matrix_alloc(ny, nx);
+  BENCH(out, "kernel", 1, kernel(&ctl, tbl, &atm, &obs, k));
+  gsl_matrix_free(k);
+
+  /* Create measurement from perturbed state... */
+  gsl_vector *xvec = gsl_vector_alloc(nx);
+  copy_atm(&ctl, &atm_true, &atm, 0);
+  atm2x(&ctl, &atm_true, xvec, NULL, NULL);
+  gsl_vector_scale(xvec, 1.05);
+  x2atm(&ctl, xvec, &atm_true);
+  copy_obs(&ctl, &obs_meas, &obs, 0);
+  formod(&ctl, tbl, &atm_true, &obs_meas);
+  gsl_vector_free(xvec);
+
+  /* Benchmark optimal_estimation()... */
+  BENCH(out, "optimal_estimation", 1,
+	optimal_estimation(&ret, &ctl, tbl, &obs_meas, &obs_i, &atm, &atm_i,
+			   &chisq, NULL));
+
+  /* Wait for pending output... */
+  write_async_flush();
+
+  /* Create ASCII files with many atmospheric data points and rays... */
+  memcpy(&ctl_asc, &ctl, sizeof(ctl_t));
+  ctl_asc.atmfmt = ctl_asc.obsfmt = ctl_asc.tblfmt = 1;
+  alloc_atm(&ctl_asc, &atm_asc, n);
+  for (int i = 0; i < n; i++) {
+    atm_asc.time[i] = i / atm.np;
+    atm_asc.z[i] = atm.z[i % atm.np];
+  }
+  atm_asc.np = n;
+  climatology(&ctl_asc, &atm_asc);
+  write_atm(ret.dir, "bench_atm.tab", &ctl_asc, &atm_asc);
+  alloc_obs(&ctl_asc, &obs_asc, n);
+  for (int i = 0; i < n; i++) {
+    obs_asc.time[i] = i / obs.nr;
+    obs_asc.obsz[i] = obs.obsz[i % obs.nr];
+    obs_asc.vpz[i] = obs.vpz[i % obs.nr];
+    obs_asc.vplat[i] = obs.vplat[i % obs.nr];
+  }
+  obs_asc.nr = n;
+  write_obs(ret.dir, "bench_obs.tab", &ctl_asc, &obs_asc);
+
+  /* Benchmark loading of ASCII files... */
+  BENCH(out, "read_atm", n,
+	read_atm(ret.dir, "bench_atm.tab", &ctl_asc, &atm_asc));
+  BENCH(out, "read_obs", n,
+	read_obs(ret.dir, "bench_obs.tab", &ctl_asc, &obs_asc));
+  BENCH(out, "read_tbl", 1, tbl_t * tbl_asc = read_tbl(&ctl_asc);
+	free(tbl_asc));
+
+  /* Close file... */
+  fclose(out);
+
+  /* Free... */
+  gsl_rng_free(rng);
+  free(x);
+  free(y);
+  free(p);
+  free(t);
+  free(u);
+  free(ig);
+  free(id);
+  free(ip);
+  free(it);
+  free_atm(&atm);
+  free_atm(&atm_i);
+  free_atm(&atm_true);
+  free_atm(&atm_asc);
+  free_los(&los);
+  free_obs(&obs);
+  free_obs(&obs_i);
+  free_obs(&obs_fov);
+  free_obs(&obs_meas);
+  free_obs(&obs_asc);
+  free(tbl);
+
+  return EXIT_SUCCESS;
+}
+
+/*****************************************************************************/
+
+void intpol_los(
+  const ctl_t *ctl,
+  const tbl_t *tbl,
+  const los_t *los,
+  const int nsweep,
+  const int ega) {
+
+  double tau_path[ND][NG], tau_seg[ND];
+
+  /* Loop over sweeps... */
+  for (int isweep = 0; isweep < nsweep; isweep++) {
+
+    /* Reset path transmittances... */
+    for (int id = 0; id < ctl->nd; id++)
+      for (int ig = 0; ig < ctl->ng; ig++)
+	tau_path[id][ig] = 1;
+
+    /* Loop over LOS points... */
+    for (int ip = 0; ip < los->np; ip++)
+      if (ega)
+	intpol_tbl_ega(ctl, tbl, los, ip, tau_path, tau_seg);
+      else
+	intpol_tbl_cga(ctl, tbl, los, ip, tau_path, tau_seg);
+  }
+}
+
+/*****************************************************************************/
+
+double ran_log(
+  const gsl_rng *rng,
+  const double x0,
+  const double x1) {
+
+  return exp(gsl_ran_flat(rng, log(x0), log(x1)));
+}
+
+/*****************************************************************************/
+
+void report(
+  FILE *out,
+  const char *name,
+  const int nop,
+  double *t_rep,
+  const int nrep) {
+
+  /* Get median and minimum time per operation... */
+  gsl_sort(t_rep, 1, (size_t) nrep);
+  const double t_med =
+    gsl_stats_median_from_sorted_data(t_rep, 1, (size_t) nrep) / nop;
+  const double t_min = t_rep[0] / nop;
+
+  /* Write results... */
+  LOG(1, "%-18s : %12.1f ns/op (min %12.1f ns/op, %d ops x %d reps)",
+      name, t_med * 1e9, t_min * 1e9, nop, nrep);
+  fprintf(out, "%-18s %10d %4d %14.3f %14.3f %14.6e\n", name, nop, nrep,
+	  t_med * 1e9, t_min * 1e9, 1 / t_med);
+}
@@ -56,10 +56,10 @@ int main(
   /* Set atmospheric grid... */
   for (double t = t0; t <= t1; t += dt)
     for (double z = z0; z <= z1; z += dz) {
+      alloc_atm(&ctl, &atm, atm.np + 1);
       atm.time[atm.np] = t;
       atm.z[atm.np] = z;
-      if ((++atm.np) >= NP)
-	ERRMSG("Too many atmospheric grid points!");
+      atm.np++;
     }
 
   /* Interpolate climatological data... */
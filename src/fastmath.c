@@ -0,0 +1,201 @@
+/*
+  This file is part of JURASSIC.
+
+  JURASSIC is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  JURASSIC is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with JURASSIC. If not, see <http://www.gnu.org/licenses/>.
+
+  Copyright (C) 2003-2025 Forschungszentrum Juelich GmbH
+*/
+
+/*!
+  \file
+  Check accuracy and speed of the fast math functions.
+*/
+
+#include "jurassic.h"
+
+/* ------------------------------------------------------------
+   Macros...
+   ------------------------------------------------------------ */
+
+/*! Evaluate expression for all samples and get time per call [ns]. */
+#define EVAL(y, expr, t) {				\
+    const double t0 = omp_get_wtime();			\
+    for (int i = 0; i < n; i++)				\
+      y[i] = (expr);					\
+    t = (omp_get_wtime() - t0) / n * 1e9;		\
+  }
+
+/* ------------------------------------------------------------
+   Functions...
+   ------------------------------------------------------------ */
+
+/*! Get distance of two doubles in units in the last place. */
+double ulp_dist(
+  const double a,
+  const double b);
+
+/*! Compare fast and reference results and write statistics. */
+void report(
+  const char *name,
+  const double x0,
+  const double x1,
+  const double *y_fast,
+  const double *y_ref,
+  const int n,
+  const double t_fast,
+  const double t_ref);
+
+/* ------------------------------------------------------------
+   Main...
+   ------------------------------------------------------------ */
+
+int main(
+  int argc,
+  char *argv[]) {
+
+  double t_fast, t_ref;
+
+  /* Check arguments... */
+  if (argc < 2)
+    ERRMSG("Give parameters: <n>");
+
+  /* Get number of samples... */
+  const int n = atoi(argv[1]);
+  if (n <= 0)
+    ERRMSG("Number of samples must be positive!");
+
+  /* Allocate... */
+  double *x, *y_fast, *y_ref;
+  ALLOC(x, double,
+	n);
+  ALLOC(y_fast, double,
+	n);
+  ALLOC(y_ref, double,
+	n);
+
+  /* Touch output arrays before timing... */
+  for (int i = 0; i < n; i++)
+    y_fast[i] = y_ref[i] = 0;
+
+  /* Initialize random number generator... */
+  gsl_rng_env_setup();
+  gsl_rng *rng = gsl_rng_alloc(gsl_rng_default);
+
+  /* Write header... */
+  printf("# $1 = function\n"
+	 "# $2 = lower limit of argument\n"
+	 "# $3 = upper limit of argument\n"
+	 "# $4 = maximum error [ULP]\n"
+	 "# $5 = mean error [ULP]\n"
+	 "# $6 = time per call of libm function [ns]\n"
+	 "# $7 = time per call of fast function [ns]\n\n");
+
+  /* Check exp()... */
+  const double exp_lim[3][2] = { {-1, 1}, {-50, 50}, {-708, 709} };
+  for (int k = 0; k < 3; k++) {
+    for (int i = 0; i < n; i++)
+      x[i] = gsl_ran_flat(rng, exp_lim[k][0], exp_lim[k][1]);
+    EVAL(y_ref, exp(x[i]), t_ref);
+    EVAL(y_fast, exp_fast(x[i]), t_fast);
+    report("exp", exp_lim[k][0], exp_lim[k][1], y_fast, y_ref, n, t_fast,
+	   t_ref);
+  }
+
+  /* Check expm1()... */
+  const double expm1_lim[3][2] = { {-1e-6, 1e-6}, {-0.5, 0.5}, {-20, 20} };
+  for (int k = 0; k < 3; k++) {
+    for (int i = 0; i < n; i++)
+      x[i] = gsl_ran_flat(rng, expm1_lim[k][0], expm1_lim[k][1]);
+    EVAL(y_ref, expm1(x[i]), t_ref);
+    EVAL(y_fast, expm1_fast(x[i]), t_fast);
+    report("expm1", expm1_lim[k][0], expm1_lim[k][1], y_fast, y_ref, n,
+	   t_fast, t_ref);
+  }
+
+  /* Check log()... */
+  const double log_lim[3][2] = { {0.5, 2}, {1e-10, 1e10}, {1e-300, 1e300} };
+  for (int k = 0; k < 3; k++) {
+    for (int i = 0; i < n; i++)
+      x[i] = exp(gsl_ran_flat(rng, log(log_lim[k][0]), log(log_lim[k][1])));
+    EVAL(y_ref, log(x[i]), t_ref);
+    EVAL(y_fast, log_fast(x[i]), t_fast);
+    report("log", log_lim[k][0], log_lim[k][1], y_fast, y_ref, n, t_fast,
+	   t_ref);
+  }
+
+  /* Check pow() for temperature ratios... */
+  const double pow_y[3] = { -4, 0.75, 4 };
+  for (int k = 0; k < 3; k++) {
+    for (int i = 0; i < n; i++)
+      x[i] = gsl_ran_flat(rng, 0.5, 2);
+    EVAL(y_ref, pow(x[i], pow_y[k]), t_ref);
+    EVAL(y_fast, pow_fast(x[i], pow_y[k]), t_fast);
+    char name[LEN];
+    sprintf(name, "pow(x,%g)", pow_y[k]);
+    report(name, 0.5, 2, y_fast, y_ref, n, t_fast, t_ref);
+  }
+
+  /* Free... */
+  gsl_rng_free(rng);
+  free(x);
+  free(y_fast);
+  free(y_ref);
+
+  return EXIT_SUCCESS;
+}
+
+/*****************************************************************************/
+
+double ulp_dist(
+  const double a,
+  const double b) {
+
+  /* Check for special values... */
+  if (a == b)
+    return 0;
+  if (!gsl_finite(a) || !gsl_finite(b) || (a < 0) != (b < 0))
+    return GSL_POSINF;
+
+  /* Compare bit patterns... */
+  int64_t ia, ib;
+  memcpy(&ia, &a, sizeof(double));
+  memcpy(&ib, &b, sizeof(double));
+  return (double) (ia > ib ? ia - ib : ib - ia);
+}
+
+/*****************************************************************************/
+
+void report(
+  const char *name,
+  const double x0,
+  const double x1,
+  const double *y_fast,
+  const double *y_ref,
+  const int n,
+  const double t_fast,
+  const double t_ref) {
+
+  double err_max = 0, err_mean = 0;
+
+  /* Compare results... */
+  for (int i = 0; i < n; i++) {
+    const double err = ulp_dist(y_fast[i], y_ref[i]);
+    err_max = GSL_MAX(err_max, err);
+    err_mean += err / n;
+  }
+
+  /* Write results... */
+  printf("%-10s %10g %10g %6g %8.3f %7.2f %7.2f\n", name, x0, x1, err_max,
+	 err_mean, t_ref, t_fast);
+}
@@ -40,7 +40,20 @@ void call_formod(
   const char *atmfile,
   const char *radfile,
   const char *task,
-  const char *obsref);
+  const char *obsref,
+  atm_t * atm,
+  atm_t * atm2,
+  obs_t * obs,
+  obs_t * obs2);
+
+/*! Perform forward model calculations chunk by chunk. */
+void call_formod_stream(
+  const ctl_t * ctl,
+  const tbl_t * tbl,
+  const char *obsfile,
+  const char *atmfile,
+  const char *radfile,
+  const int obschunk);
 
 /*! Calculate relative errors. */
 void compute_rel_errors(
@@ -89,7 +102,7 @@ int main(
 
 #else
 
-  char dirlist[LEN], obsref[LEN], task[LEN];
+  char batch[LEN], batchout[LEN], dirlist[LEN], obsref[LEN], task[LEN];
 
   /* Initialize look-up tables... */
   tbl_t *tbl = read_tbl(&ctl);
@@ -103,35 +116,189 @@ int main(
   /* Get reference data... */
   scan_ctl(argc, argv, "OBSREF", -1, "-", obsref);
 
+  /* Get profile containers... */
+  scan_ctl(argc, argv, "BATCH", -1, "-", batch);
+  scan_ctl(argc, argv, "BATCHOUT", -1, "-", batchout);
+
+  /* Get number of ray paths per chunk for streaming... */
+  const int obschunk = (int) scan_ctl(argc, argv, "OBSCHUNK", -1, "0", NULL);
+
+  /* Get number of directories processed in parallel... */
+  const int dirpar = (int) scan_ctl(argc, argv, "DIRPAR", -1, "1", NULL);
+  if (dirpar < 1)
+    ERRMSG("DIRPAR must be positive!");
+
+  /* Check streaming mode... */
+  if (obschunk > 0 && (dirlist[0] != '-' || batch[0] != '-'))
+    ERRMSG("OBSCHUNK is not supported with DIRLIST or BATCH!");
+
+  /* Work on profile container... */
+  if (batch[0] != '-') {
+
+    prf_t prf_in, prf_out;
+
+    /* Check arguments... */
+    if (batchout[0] == '-')
+      ERRMSG("Set BATCHOUT to process a profile container!");
+    if (task[0] != '-' || obsref[0] != '-')
+      ERRMSG("TASK and OBSREF are not supported for profile containers!");
+
+    /* Open profile containers... */
+    read_prf_open(batch, &ctl, &prf_in);
+    write_prf_create(batchout, &ctl, prf_in.n, &prf_out);
+    const size_t nrec = prf_in.n;
+
+    /* Loop over records (pool of workers)... */
+#pragma omp parallel num_threads(dirpar) default(none) shared(ctl,tbl,prf_in,prf_out,nrec)
+    {
+      /* Allocate per-worker buffers... */
+      atm_t *atm;
+      obs_t *obs;
+      ALLOC(atm, atm_t, 1);
+      ALLOC(obs, obs_t, 1);
+
+#pragma omp for schedule(dynamic)
+      for (size_t rec = 0; rec < nrec; rec++) {
+
+	/* Read record... */
+	read_prf_single(&prf_in, &ctl, rec, atm, obs);
+
+	/* Call forward model... */
+	formod(&ctl, tbl, atm, obs);
+
+	/* Write record... */
+	write_prf_single(&prf_out, &ctl, rec, atm, obs);
+      }
+
+      /* Free... */
+      free_atm(atm);
+      free_obs(obs);
+      free(atm);
+      free(obs);
+    }
+
+    /* Close profile containers... */
+    read_prf_close(&prf_in);
+    write_prf_close(&prf_out);
+  }
+
+  /* Streaming forward calculation... */
+  else if (obschunk > 0) {
+
+    /* Check arguments... */
+    if (task[0] != '-' || obsref[0] != '-')
+      ERRMSG("TASK and OBSREF are not supported with OBSCHUNK!");
+
+    /* Call forward model... */
+    call_formod_stream(&ctl, tbl, argv[2], argv[3], argv[4], obschunk);
+  }
+
   /* Single forward calculation... */
-  if (dirlist[0] == '-')
-    call_formod(&ctl, tbl, NULL, argv[2], argv[3], argv[4], task, obsref);
+  else if (dirlist[0] == '-') {
+
+    /* Allocate... */
+    atm_t *atm, *atm2;
+    obs_t *obs, *obs2;
+    ALLOC(atm, atm_t, 1);
+    ALLOC(atm2, atm_t, 1);
+    ALLOC(obs, obs_t, 1);
+    ALLOC(obs2, obs_t, 1);
+
+    /* Call forward model... */
+    call_formod(&ctl, tbl, NULL, argv[2], argv[3], argv[4], task, obsref,
+		atm, atm2, obs, obs2);
+
+    /* Free... */
+    free_atm(atm);
+    free_atm(atm2);
+    free_obs(obs);
+    free_obs(obs2);
+    free(atm);
+    free(atm2);
+    free(obs);
+    free(obs2);
+  }
 
   /* Work on directory list... */
   else {
 
-    /* Open directory list... */
+    char **dirs, wrkdir[LEN];
+
+    int ndir = 0;
+
+    /* Read directory list... */
     FILE *in;
     if (!(in = fopen(dirlist, "r")))
       ERRMSG("Cannot open directory list!");
+    while (fscanf(in, "%4999s", wrkdir) != EOF)
+      ndir++;
+    ALLOC(dirs, char *,
+	  ndir);
+    rewind(in);
+    for (int idir = 0; idir < ndir; idir++) {
+      if (fscanf(in, "%4999s", wrkdir) != 1)
+	ERRMSG("Error while reading directory list!");
+      ALLOC(dirs[idir], char,
+	    strlen(wrkdir) + 1);
+      strcpy(dirs[idir], wrkdir);
+    }
+    fclose(in);
 
-    /* Loop over directories... */
-    char wrkdir[LEN];
-    while (fscanf(in, "%4999s", wrkdir) != EOF) {
+    /* Loop over directories (pool of workers)... */
+#pragma omp parallel num_threads(dirpar) default(none) shared(argv,ctl,tbl,task,obsref,dirs,ndir,dirpar)
+    {
+      /* Allocate per-worker buffers... */
+      ctl_t *ctl2;
+      atm_t *atm, *atm2;
+      obs_t *obs, *obs2;
+      ALLOC(ctl2, ctl_t, 1);
+      ALLOC(atm, atm_t, 1);
+      ALLOC(atm2, atm_t, 1);
+      ALLOC(obs, obs_t, 1);
+      ALLOC(obs2, obs_t, 1);
+
+#pragma omp for schedule(dynamic)
+      for (int idir = 0; idir < ndir; idir++) {
+
+	/* Buffer log messages... */
+	if (dirpar > 1)
+	  log_buffer_open();
+
+	/* Write info... */
+	LOG(1, "\nWorking directory: %s", dirs[idir]);
 
-      /* Write info... */
-      LOG(1, "\nWorking directory: %s", wrkdir);
+	/* Call forward model... */
+	memcpy(ctl2, &ctl, sizeof(ctl_t));
+	call_formod(ctl2, tbl, dirs[idir], argv[2], argv[3], argv[4], task,
+		    obsref, atm, atm2, obs, obs2);
 
-      /* Call forward model... */
-      call_formod(&ctl, tbl, wrkdir, argv[2], argv[3], argv[4], task, obsref);
+	/* Write log messages... */
+	log_buffer_close();
+      }
+
+      /* Free... */
+      free_atm(atm);
+      free_atm(atm2);
+      free_obs(obs);
+      free_obs(obs2);
+      free(ctl2);
+      free(atm);
+      free(atm2);
+      free(obs);
+      free(obs2);
     }
 
-    /* Close dirlist... */
-    fclose(in);
+    /* Free... */
+    for (int idir = 0; idir < ndir; idir++)
+      free(dirs[idir]);
+    free(dirs);
   }
 
 #endif
 
+  /* Wait for pending output... */
+  write_async_flush();
+
   /* Free... */
   free(tbl);
 
@@ -148,90 +315,93 @@ void call_formod(
   const char *atmfile,
   const char *radfile,
   const char *task,
-  const char *obsref) {
-
-  static atm_t atm, atm2;
-  static obs_t obs, obs2;
+  const char *obsref,
+  atm_t *atm,
+  atm_t *atm2,
+  obs_t *obs,
+  obs_t *obs2) {
 
   /* Read atmospheric data... */
-  read_atm(wrkdir, atmfile, ctl, &atm);
+  read_atm(wrkdir, atmfile, ctl, atm);
 
   /* Read observation geometry... */
-  read_obs(wrkdir, obsfile, ctl, &obs);
+  read_obs(wrkdir, obsfile, ctl, obs);
 
   /* Compute multiple profiles... */
   if (task[0] == 'p' || task[0] == 'P') {
 
     /* Loop over ray paths... */
-    for (int ir = 0; ir < obs.nr; ir++) {
+    for (int ir = 0; ir < obs->nr; ir++) {
 
       /* Get atmospheric data... */
-      atm2.np = 0;
-      for (int ip = 0; ip < atm.np; ip++)
-	if (atm.time[ip] == obs.time[ir]) {
-	  atm2.time[atm2.np] = atm.time[ip];
-	  atm2.z[atm2.np] = atm.z[ip];
-	  atm2.lon[atm2.np] = atm.lon[ip];
-	  atm2.lat[atm2.np] = atm.lat[ip];
-	  atm2.p[atm2.np] = atm.p[ip];
-	  atm2.t[atm2.np] = atm.t[ip];
+      alloc_atm(ctl, atm2, atm->np);
+      atm2->np = 0;
+      for (int ip = 0; ip < atm->np; ip++)
+	if (atm->time[ip] == obs->time[ir]) {
+	  atm2->time[atm2->np] = atm->time[ip];
+	  atm2->z[atm2->np] = atm->z[ip];
+	  atm2->lon[atm2->np] = atm->lon[ip];
+	  atm2->lat[atm2->np] = atm->lat[ip];
+	  atm2->p[atm2->np] = atm->p[ip];
+	  atm2->t[atm2->np] = atm->t[ip];
 	  for (int ig = 0; ig < ctl->ng; ig++)
-	    atm2.q[ig][atm2.np] = atm.q[ig][ip];
+	    atm2->q[ig][atm2->np] = atm->q[ig][ip];
 	  for (int iw = 0; iw < ctl->nw; iw++)
-	    atm2.k[iw][atm2.np] = atm.k[iw][ip];
-	  atm2.np++;
+	    atm2->k[iw][atm2->np] = atm->k[iw][ip];
+	  atm2->np++;
 	}
 
       /* Get observation data... */
-      obs2.nr = 1;
-      obs2.time[0] = obs.time[ir];
-      obs2.vpz[0] = obs.vpz[ir];
-      obs2.vplon[0] = obs.vplon[ir];
-      obs2.vplat[0] = obs.vplat[ir];
-      obs2.obsz[0] = obs.obsz[ir];
-      obs2.obslon[0] = obs.obslon[ir];
-      obs2.obslat[0] = obs.obslat[ir];
+      alloc_obs(ctl, obs2, 1);
+      obs2->nr = 1;
+      obs2->time[0] = obs->time[ir];
+      obs2->vpz[0] = obs->vpz[ir];
+      obs2->vplon[0] = obs->vplon[ir];
+      obs2->vplat[0] = obs->vplat[ir];
+      obs2->obsz[0] = obs->obsz[ir];
+      obs2->obslon[0] = obs->obslon[ir];
+      obs2->obslat[0] = obs->obslat[ir];
 
       /* Check number of data points... */
-      if (atm2.np > 0) {
+      if (atm2->np > 0) {
 
 	/* Call forward model... */
-	formod(ctl, tbl, &atm2, &obs2);
+	formod(ctl, tbl, atm2, obs2);
 
 	/* Save radiance data... */
 	for (int id = 0; id < ctl->nd; id++) {
-	  obs.rad[id][ir] = obs2.rad[id][0];
-	  obs.tau[id][ir] = obs2.tau[id][0];
+	  obs->rad[id][ir] = obs2->rad[id][0];
+	  obs->tau[id][ir] = obs2->tau[id][0];
 	}
       }
     }
 
     /* Write radiance data... */
-    write_obs(wrkdir, radfile, ctl, &obs);
+    write_obs_async(wrkdir, radfile, ctl, obs);
   }
 
   /* Compute single profile... */
   else {
 
     /* Call forward model... */
-    formod(ctl, tbl, &atm, &obs);
+    formod(ctl, tbl, atm, obs);
 
     /* Save radiance data... */
-    write_obs(wrkdir, radfile, ctl, &obs);
+    write_obs_async(wrkdir, radfile, ctl, obs);
 
     /* Evaluate results... */
     if (obsref[0] != '-') {
 
       /* Read reference data... */
-      read_obs(wrkdir, obsref, ctl, &obs2);
+      read_obs(wrkdir, obsref, ctl, obs2);
 
       /* Calculate relative errors... */
       double mre[ND], sdre[ND], minre[ND], maxre[ND];
-      compute_rel_errors(ctl, &obs, &obs2, mre, sdre, minre, maxre);
+      compute_rel_errors(ctl, obs, obs2, mre, sdre, minre, maxre);
 
       /* Write results... */
       for (int id = 0; id < ctl->nd; id++)
-	printf
+	LOGPRINTF
 	  ("EVAL: nu= %.4f cm^-1 | MRE= %g %% | SDRE= %g %% | MinRE= %g %% | MaxRE= %g %%\n",
 	   ctl->nu[id], mre[id], sdre[id], minre[id], maxre[id]);
     }
@@ -251,48 +421,48 @@ void call_formod(
       for (int ig = 0; ig < ctl->ng; ig++) {
 
 	/* Copy atmospheric data... */
-	copy_atm(ctl, &atm2, &atm, 0);
+	copy_atm(ctl, atm2, atm, 0);
 
 	/* Set extinction to zero... */
 	for (int iw = 0; iw < ctl->nw; iw++)
-	  for (int ip = 0; ip < atm2.np; ip++)
-	    atm2.k[iw][ip] = 0;
+	  for (int ip = 0; ip < atm2->np; ip++)
+	    atm2->k[iw][ip] = 0;
 
 	/* Select emitter... */
 	for (int ig2 = 0; ig2 < ctl->ng; ig2++)
 	  if (ig2 != ig)
-	    for (int ip = 0; ip < atm2.np; ip++)
-	      atm2.q[ig2][ip] = 0;
+	    for (int ip = 0; ip < atm2->np; ip++)
+	      atm2->q[ig2][ip] = 0;
 
 	/* Call forward model... */
-	formod(ctl, tbl, &atm2, &obs);
+	formod(ctl, tbl, atm2, obs);
 
 	/* Save radiance data... */
 	sprintf(filename, "%s.%s", radfile, ctl->emitter[ig]);
-	write_obs(wrkdir, filename, ctl, &obs);
+	write_obs_async(wrkdir, filename, ctl, obs);
       }
 
       /* Copy atmospheric data... */
-      copy_atm(ctl, &atm2, &atm, 0);
+      copy_atm(ctl, atm2, atm, 0);
 
       /* Set volume mixing ratios to zero, keep extinction... */
       for (int ig = 0; ig < ctl->ng; ig++)
-	for (int ip = 0; ip < atm2.np; ip++)
-	  atm2.q[ig][ip] = 0;
+	for (int ip = 0; ip < atm2->np; ip++)
+	  atm2->q[ig][ip] = 0;
 
       /* Call forward model... */
-      formod(ctl, tbl, &atm2, &obs);
+      formod(ctl, tbl, atm2, obs);
 
       /* Save radiance data... */
       sprintf(filename, "%s.EXTINCT", radfile);
-      write_obs(wrkdir, filename, ctl, &obs);
+      write_obs_async(wrkdir, filename, ctl, obs);
     }
 
     /* Measure CPU-time... */
     if (task[0] == 't' || task[0] == 'T') {
 
       /* Init... */
-      double t_min, t_max, t_mean = 0, t_sd = 0;
+      double t_min = 0, t_max = 0, t_mean = 0, t_sd = 0;
       int n = 0;
 
       /* Initialize random number generator... */
@@ -303,22 +473,22 @@ void call_formod(
       do {
 
 	/* Create random atmosphere... */
-	copy_atm(ctl, &atm2, &atm, 0);
+	copy_atm(ctl, atm2, atm, 0);
 	double dtemp = 40. * (gsl_rng_uniform(rng) - 0.5);
 	double dpress = 1. - 0.1 * gsl_rng_uniform(rng);
 	double dq[NG];
 	for (int ig = 0; ig < ctl->ng; ig++)
 	  dq[ig] = 0.8 + 0.4 * gsl_rng_uniform(rng);
-	for (int ip = 0; ip < atm2.np; ip++) {
-	  atm2.t[ip] += dtemp;
-	  atm2.p[ip] *= dpress;
+	for (int ip = 0; ip < atm2->np; ip++) {
+	  atm2->t[ip] += dtemp;
+	  atm2->p[ip] *= dpress;
 	  for (int ig = 0; ig < ctl->ng; ig++)
-	    atm2.q[ig][ip] *= dq[ig];
+	    atm2->q[ig][ip] *= dq[ig];
 	}
 
 	/* Measure runtime... */
 	double t0 = omp_get_wtime();
-	formod(ctl, tbl, &atm2, &obs);
+	formod(ctl, tbl, atm2, obs);
 	double dt = omp_get_wtime() - t0;
 
 	/* Get runtime statistics... */
@@ -335,7 +505,7 @@ void call_formod(
       /* Write results... */
       t_mean /= (double) n;
       t_sd = sqrt(t_sd / (double) n - POW2(t_mean));
-      printf("RUNTIME: mean= %g s | stddev= %g s | min= %g s | max= %g s\n",
+      LOGPRINTF("RUNTIME: mean= %g s | stddev= %g s | min= %g s | max= %g s\n",
 	     t_mean, t_sd, t_min, t_max);
 
       /* Free... */
@@ -348,8 +518,8 @@ void call_formod(
       /* Reference run... */
       ctl->rayds = 0.1;
       ctl->raydz = 0.01;
-      formod(ctl, tbl, &atm, &obs);
-      copy_obs(ctl, &obs2, &obs, 0);
+      formod(ctl, tbl, atm, obs);
+      copy_obs(ctl, obs2, obs, 0);
 
       /* Loop over step size... */
       for (double dz = 0.01; dz <= 2; dz *= 1.1)
@@ -361,16 +531,16 @@ void call_formod(
 
 	  /* Measure runtime... */
 	  double t0 = omp_get_wtime();
-	  formod(ctl, tbl, &atm, &obs);
+	  formod(ctl, tbl, atm, obs);
 	  double dt = omp_get_wtime() - t0;
 
 	  /* Calculate relative errors... */
 	  double mre[ND], sdre[ND], minre[ND], maxre[ND];
-	  compute_rel_errors(ctl, &obs, &obs2, mre, sdre, minre, maxre);
+	  compute_rel_errors(ctl, obs, obs2, mre, sdre, minre, maxre);
 
 	  /* Write results... */
 	  for (int id = 0; id < ctl->nd; id++)
-	    printf
+	    LOGPRINTF
 	      ("STEPSIZE: ds= %.4f km | dz= %g km | t= %g s | nu= %.4f cm^-1"
 	       " | MRE= %g %% | SDRE= %g %% | MinRE= %g %% | MaxRE= %g %%\n",
 	       ds, dz, dt, ctl->nu[id], mre[id], sdre[id], minre[id],
@@ -382,6 +552,72 @@ void call_formod(
 
 /*****************************************************************************/
 
+void call_formod_stream(
+  const ctl_t *ctl,
+  const tbl_t *tbl,
+  const char *obsfile,
+  const char *atmfile,
+  const char *radfile,
+  const int obschunk) {
+
+  atm_t *atm, *atm2;
+  obs_t *obs;
+
+  FILE *in, *out;
+
+  /* Check file format... */
+  if (ctl->obsfmt != 1)
+    ERRMSG("OBSCHUNK requires ASCII observation files (OBSFMT 1)!");
+
+  /* Allocate... */
+  ALLOC(atm, atm_t, 1);
+  ALLOC(atm2, atm_t, 1);
+  ALLOC(obs, obs_t, 1);
+
+  /* Read atmospheric data... */
+  read_atm(NULL, atmfile, ctl, atm);
+
+  /* Open files... */
+  LOG(1, "Read observation data: %s", obsfile);
+  if (!(in = fopen(obsfile, "r")))
+    ERRMSG("Cannot open file!");
+  LOG(1, "Write observation data: %s", radfile);
+  if (!(out = fopen(radfile, "w")))
+    ERRMSG("Cannot create file!");
+
+  /* Loop over chunks of ray paths... */
+  double t0 = NAN;
+  int nline = 0;
+  for (int ichunk = 0;
+       read_obs_asc_chunk(in, ctl, obs, obschunk, &nline) > 0; ichunk++) {
+
+    /* Write info... */
+    LOG(2, "Chunk %d: %d ray paths", ichunk, obs->nr);
+
+    /* Call forward model (on a copy, hydrostatic() changes the data)... */
+    copy_atm(ctl, atm2, atm, 0);
+    formod(ctl, tbl, atm2, obs);
+
+    /* Write radiance data... */
+    write_obs_asc_chunk(out, ctl, obs, ichunk == 0, t0);
+    t0 = obs->time[obs->nr - 1];
+  }
+
+  /* Close files... */
+  fclose(in);
+  fclose(out);
+
+  /* Free... */
+  free_atm(atm);
+  free_atm(atm2);
+  free_obs(obs);
+  free(atm);
+  free(atm2);
+  free(obs);
+}
+
+/*****************************************************************************/
+
 void compute_rel_errors(
   const ctl_t *ctl,
   const obs_t *obs_test,
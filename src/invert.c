@@ -97,6 +97,7 @@ int main(
   ctl.write_matrix = 1;
 
   /* Set observation data... */
+  alloc_obs(&ctl, &obs, 1);
   obs.nr = 1;
   obs.obsz[0] = 705;
 
@@ -133,6 +134,9 @@ int main(
      Fit scaling factor for total mass...
      ------------------------------------------------------------ */
 
+  /* Allocate... */
+  alloc_atm(&ctl, &atm, 1);
+
   /* Iterations... */
   for (int it = 0; it < itmax; it++) {
 
@@ -186,6 +190,7 @@ int main(
 
 	/* Calculate mean atmospheric profile... */
 	nprof++;
+	alloc_atm(&ctl, &atm2, atm.np);
 	atm2.np = atm.np;
 	for (int ip = 0; ip < atm.np; ip++) {
 	  atm2.time[ip] += atm.time[ip];
@@ -203,6 +208,7 @@ int main(
       }
 
       /* Save data... */
+      alloc_atm(&ctl, &atm, atm.np + 1);
       obs_meas = robs[il];
       atm.time[atm.np] = rtime[il];
       atm.z[atm.np] = rz[il];
@@ -215,8 +221,7 @@ int main(
       atm.q[2][atm.np] = ro3[il];
       atm.q[3][atm.np] = 371.789948e-6 + 2.026214e-6
 	* (atm.time[atm.np] - 63158400.) / 31557600.;
-      if ((++atm.np) > NP)
-	ERRMSG("Too many data points!");
+      atm.np++;
     }
 
     /* Calculate means... */
@@ -24,6 +24,223 @@
 
 #include "jurassic.h"
 
+/* ------------------------------------------------------------
+   Global variables...
+   ------------------------------------------------------------ */
+
+_Thread_local FILE *log_stream = NULL;
+
+_Thread_local char *log_buf = NULL;
+
+_Thread_local size_t log_len = 0;
+
+_Thread_local jmp_buf *err_jmp = NULL;
+
+_Thread_local cnt_t *cnt_local = NULL;
+
+/* Serialize output of buffered log messages (see log_buffer_close)... */
+static pthread_mutex_t log_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Event counters of all threads (see cnt_alloc)... */
+static cnt_t *cnt_threads = NULL;
+
+/* Queue of the asynchronous writer (see write_async_submit)... */
+static pthread_mutex_t wrt_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wrt_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t wrt_thread;
+static wrt_job_t **wrt_queue = NULL;
+static int wrt_nmax = 0, wrt_n = 0, wrt_head = 0, wrt_running = 0,
+  wrt_stop = 0;
+static char wrt_error[2 * LEN] = "";
+
+/* Profiling timers (see prof_start)... */
+static _Thread_local prof_thread_t *prof_local = NULL;
+static prof_thread_t *prof_threads = NULL;
+static char prof_names[PROFNS][LEN], prof_file[LEN];
+static int prof_nscope = 0;
+
+/*****************************************************************************/
+
+double *alloc_1d(
+  double *a,
+  const size_t n_old,
+  const size_t n) {
+
+  /* Reallocate... */
+  if ((a = realloc(a, MAX(n, 1) * sizeof(double))) == NULL)
+    ERRMSG("Out of memory!");
+
+  /* Initialize new elements... */
+  if (n > n_old)
+    memset(a + n_old, 0, (n - n_old) * sizeof(double));
+
+  return a;
+}
+
+/*****************************************************************************/
+
+double **alloc_2d(
+  double **a,
+  const size_t n1_old,
+  const size_t n2_old,
+  const size_t n1,
+  const size_t n2) {
+
+  double **b;
+
+  /* Allocate row pointers and contiguous data block... */
+  ALLOC(b, double *,
+	MAX(n1, 1));
+  ALLOC(b[0], double,
+	MAX(n1 * n2, 1));
+  for (size_t i = 1; i < n1; i++)
+    b[i] = b[0] + i * n2;
+
+  /* Copy old data... */
+  if (a != NULL) {
+    for (size_t i = 0; i < MIN(n1, n1_old); i++)
+      memcpy(b[i], a[i], MIN(n2, n2_old) * sizeof(double));
+    free_2d(a);
+  }
+
+  return b;
+}
+
+/*****************************************************************************/
+
+void alloc_atm(
+  const ctl_t *ctl,
+  atm_t *atm,
+  const int np) {
+
+  /* Check whether current size is sufficient... */
+  if (np <= atm->np_alloc && ctl->ng <= atm->ng_alloc
+      && ctl->nw <= atm->nw_alloc && atm->time != NULL)
+    return;
+
+  /* Move memory-mapped data to the heap before resizing... */
+  if (atm->map != NULL) {
+    atm_t tmp;
+    memset(&tmp, 0, sizeof(atm_t));
+    copy_atm(ctl, &tmp, atm, 0);
+    free_atm(atm);
+    memcpy(atm, &tmp, sizeof(atm_t));
+  }
+
+  /* Get new sizes (grow geometrically)... */
+  const int np_new =
+    (np > atm->np_alloc ? MAX(np, 2 * atm->np_alloc) : atm->np_alloc);
+  const int ng_new = MAX(ctl->ng, atm->ng_alloc);
+  const int nw_new = MAX(ctl->nw, atm->nw_alloc);
+  const size_t n0 = (size_t) atm->np_alloc, n1 = (size_t) np_new;
+
+  /* Reallocate... */
+  atm->time = alloc_1d(atm->time, n0, n1);
+  atm->z = alloc_1d(atm->z, n0, n1);
+  atm->lon = alloc_1d(atm->lon, n0, n1);
+  atm->lat = alloc_1d(atm->lat, n0, n1);
+  atm->p = alloc_1d(atm->p, n0, n1);
+  atm->t = alloc_1d(atm->t, n0, n1);
+  atm->q = alloc_2d(atm->q, (size_t) atm->ng_alloc, n0, (size_t) ng_new, n1);
+  atm->k = alloc_2d(atm->k, (size_t) atm->nw_alloc, n0, (size_t) nw_new, n1);
+
+  /* Save sizes... */
+  atm->np_alloc = np_new;
+  atm->ng_alloc = ng_new;
+  atm->nw_alloc = nw_new;
+}
+
+/*****************************************************************************/
+
+void alloc_los(
+  const ctl_t *ctl,
+  los_t *los,
+  const int np) {
+
+  /* Check whether current size is sufficient... */
+  if (np <= los->np_alloc && ctl->ng <= los->ng_alloc
+      && ctl->nd <= los->nd_alloc && los->z != NULL)
+    return;
+
+  /* Get new sizes (grow geometrically)... */
+  const int np_new =
+    (np > los->np_alloc ? MAX(np, 2 * los->np_alloc) : los->np_alloc);
+  const int ng_new = MAX(ctl->ng, los->ng_alloc);
+  const int nd_new = MAX(ctl->nd, los->nd_alloc);
+  const size_t n0 = (size_t) los->np_alloc, n1 = (size_t) np_new;
+  const size_t g0 = (size_t) los->ng_alloc, g1 = (size_t) ng_new;
+  const size_t d0 = (size_t) los->nd_alloc, d1 = (size_t) nd_new;
+
+  /* Reallocate... */
+  los->z = alloc_1d(los->z, n0, n1);
+  los->lon = alloc_1d(los->lon, n0, n1);
+  los->lat = alloc_1d(los->lat, n0, n1);
+  los->p = alloc_1d(los->p, n0, n1);
+  los->t = alloc_1d(los->t, n0, n1);
+  los->ds = alloc_1d(los->ds, n0, n1);
+  los->sfeps = alloc_1d(los->sfeps, d0, d1);
+  los->q = alloc_2d(los->q, n0, g0, n1, g1);
+  los->u = alloc_2d(los->u, n0, g0, n1, g1);
+  los->cgp = alloc_2d(los->cgp, n0, g0, n1, g1);
+  los->cgt = alloc_2d(los->cgt, n0, g0, n1, g1);
+  los->cgu = alloc_2d(los->cgu, n0, g0, n1, g1);
+  los->k = alloc_2d(los->k, n0, d0, n1, d1);
+  los->eps = alloc_2d(los->eps, n0, d0, n1, d1);
+  los->src = alloc_2d(los->src, n0, d0, n1, d1);
+
+  /* Save sizes... */
+  los->np_alloc = np_new;
+  los->ng_alloc = ng_new;
+  los->nd_alloc = nd_new;
+}
+
+/*****************************************************************************/
+
+void alloc_obs(
+  const ctl_t *ctl,
+  obs_t *obs,
+  const int nr) {
+
+  /* Check whether current size is sufficient... */
+  if (nr <= obs->nr_alloc && ctl->nd <= obs->nd_alloc && obs->time != NULL)
+    return;
+
+  /* Move memory-mapped data to the heap before resizing... */
+  if (obs->map != NULL) {
+    obs_t tmp;
+    memset(&tmp, 0, sizeof(obs_t));
+    copy_obs(ctl, &tmp, obs, 0);
+    free_obs(obs);
+    memcpy(obs, &tmp, sizeof(obs_t));
+  }
+
+  /* Get new sizes (grow geometrically)... */
+  const int nr_new =
+    (nr > obs->nr_alloc ? MAX(nr, 2 * obs->nr_alloc) : obs->nr_alloc);
+  const int nd_new = MAX(ctl->nd, obs->nd_alloc);
+  const size_t n0 = (size_t) obs->nr_alloc, n1 = (size_t) nr_new;
+
+  /* Reallocate... */
+  obs->time = alloc_1d(obs->time, n0, n1);
+  obs->obsz = alloc_1d(obs->obsz, n0, n1);
+  obs->obslon = alloc_1d(obs->obslon, n0, n1);
+  obs->obslat = alloc_1d(obs->obslat, n0, n1);
+  obs->vpz = alloc_1d(obs->vpz, n0, n1);
+  obs->vplon = alloc_1d(obs->vplon, n0, n1);
+  obs->vplat = alloc_1d(obs->vplat, n0, n1);
+  obs->tpz = alloc_1d(obs->tpz, n0, n1);
+  obs->tplon = alloc_1d(obs->tplon, n0, n1);
+  obs->tplat = alloc_1d(obs->tplat, n0, n1);
+  obs->tau =
+    alloc_2d(obs->tau, (size_t) obs->nd_alloc, n0, (size_t) nd_new, n1);
+  obs->rad =
+    alloc_2d(obs->rad, (size_t) obs->nd_alloc, n0, (size_t) nd_new, n1);
+
+  /* Save sizes... */
+  obs->nr_alloc = nr_new;
+  obs->nd_alloc = nd_new;
+}
+
 /*****************************************************************************/
 
 void analyze_avk(
@@ -34,18 +251,22 @@ void analyze_avk(
   const int *ipa,
   const gsl_matrix *avk) {
 
-  static atm_t atm_cont, atm_res;
+  atm_t *atm_cont, *atm_res;
 
   size_t i, n0[NQ], n1[NQ];
 
   /* Get sizes... */
   const size_t n = avk->size1;
 
+  /* Allocate... */
+  ALLOC(atm_cont, atm_t, 1);
+  ALLOC(atm_res, atm_t, 1);
+
   /* Find sub-matrices for different quantities... */
   for (int iq = 0; iq < NQ; iq++) {
-    n0[iq] = N;
+    n0[iq] = n;
     for (i = 0; i < n; i++) {
-      if (iqa[i] == iq && n0[iq] == N)
+      if (iqa[i] == iq && n0[iq] == n)
 	n0[iq] = i;
       if (iqa[i] == iq)
 	n1[iq] = i - n0[iq] + 1;
@@ -53,32 +274,34 @@ void analyze_avk(
   }
 
   /* Initialize... */
-  copy_atm(ctl, &atm_cont, atm, 1);
-  copy_atm(ctl, &atm_res, atm, 1);
+  copy_atm(ctl, atm_cont, atm, 1);
+  copy_atm(ctl, atm_res, atm, 1);
 
   /* Analyze quantities... */
-  analyze_avk_quantity(avk, IDXP, ipa, n0, n1, atm_cont.p, atm_res.p);
-  analyze_avk_quantity(avk, IDXT, ipa, n0, n1, atm_cont.t, atm_res.t);
+  analyze_avk_quantity(avk, IDXP, ipa, n0, n1, atm_cont->p, atm_res->p);
+  analyze_avk_quantity(avk, IDXT, ipa, n0, n1, atm_cont->t, atm_res->t);
   for (int ig = 0; ig < ctl->ng; ig++)
     analyze_avk_quantity(avk, IDXQ(ig), ipa, n0, n1,
-			 atm_cont.q[ig], atm_res.q[ig]);
+			 atm_cont->q[ig], atm_res->q[ig]);
   for (int iw = 0; iw < ctl->nw; iw++)
     analyze_avk_quantity(avk, IDXK(iw), ipa, n0, n1,
-			 atm_cont.k[iw], atm_res.k[iw]);
-  analyze_avk_quantity(avk, IDXCLZ, ipa, n0, n1, &atm_cont.clz, &atm_res.clz);
-  analyze_avk_quantity(avk, IDXCLDZ, ipa, n0, n1, &atm_cont.cldz,
-		       &atm_res.cldz);
+			 atm_cont->k[iw], atm_res->k[iw]);
+  analyze_avk_quantity(avk, IDXCLZ, ipa, n0, n1, &atm_cont->clz,
+		       &atm_res->clz);
+  analyze_avk_quantity(avk, IDXCLDZ, ipa, n0, n1, &atm_cont->cldz,
+		       &atm_res->cldz);
   for (int icl = 0; icl < ctl->ncl; icl++)
     analyze_avk_quantity(avk, IDXCLK(icl), ipa, n0, n1,
-			 &atm_cont.clk[icl], &atm_res.clk[icl]);
-  analyze_avk_quantity(avk, IDXSFT, ipa, n0, n1, &atm_cont.sft, &atm_res.sft);
+			 &atm_cont->clk[icl], &atm_res->clk[icl]);
+  analyze_avk_quantity(avk, IDXSFT, ipa, n0, n1, &atm_cont->sft,
+		       &atm_res->sft);
   for (int isf = 0; isf < ctl->nsf; isf++)
     analyze_avk_quantity(avk, IDXSFEPS(isf), ipa, n0, n1,
-			 &atm_cont.sfeps[isf], &atm_res.sfeps[isf]);
+			 &atm_cont->sfeps[isf], &atm_res->sfeps[isf]);
 
   /* Write results to disk... */
-  write_atm(ret->dir, "atm_cont.tab", ctl, &atm_cont);
-  write_atm(ret->dir, "atm_res.tab", ctl, &atm_res);
+  write_atm_async_own(ret->dir, "atm_cont.tab", ctl, atm_cont);
+  write_atm_async_own(ret->dir, "atm_res.tab", ctl, atm_res);
 }
 
 /*****************************************************************************/
@@ -93,7 +316,7 @@ void analyze_avk_quantity(
   double *res) {
 
   /* Loop over state vector elements... */
-  if (n0[iq] < N)
+  if (n0[iq] < avk->size1)
     for (size_t i = 0; i < n1[iq]; i++) {
 
       /* Get area of averaging kernel... */
@@ -3109,7 +3332,7 @@ double ctmh2o(
       sfac = (1 - dx) * xfcrev[ix] + dx * xfcrev[ix + 1];
     }
     const double ctwslf =
-      sfac * cw296 * pow(cw260 / cw296, (296 - t) / (296 - 260));
+      sfac * cw296 * MPOW(cw260 / cw296, (296 - t) / (296 - 260));
     const double vf2 = POW2(nu - 370);
     const double vf6 = POW3(vf2);
     const double fscal = 36100 / (vf2 + vf6 * 1e-8 + 36100) * -.25 + 1;
@@ -3187,7 +3410,7 @@ double ctmn2(
     LIN(nua[idx], betaa[idx], nua[idx + 1], betaa[idx + 1], nu);
 
   /* Compute absorption coefficient... */
-  return 0.1 * POW2(p / P0 * t0 / t) * exp(beta * (1 / tr - 1 / t))
+  return 0.1 * POW2(p / P0 * t0 / t) * MEXP(beta * (1 / tr - 1 / t))
     * N2 * b * (N2 + (1 - N2) * (1.294 - 0.4545 * t / tr));
 }
 
@@ -3250,7 +3473,133 @@ double ctmo2(
     LIN(nua[idx], betaa[idx], nua[idx + 1], betaa[idx + 1], nu);
 
   /* Compute absorption coefficient... */
-  return 0.1 * POW2(p / P0 * t0 / t) * exp(beta * (1 / tr - 1 / t)) * O2 * b;
+  return 0.1 * POW2(p / P0 * t0 / t) * MEXP(beta * (1 / tr - 1 / t)) * O2 * b;
+}
+
+/*****************************************************************************/
+
+void clamp_atm(
+  const ctl_t *ctl,
+  atm_t *atm,
+  const int *iqa,
+  const int *ipa,
+  const size_t n) {
+
+  /* Loop over state vector elements... */
+  for (size_t i = 0; i < n; i++) {
+
+    /* Get indices... */
+    const int iq = iqa[i];
+    const int ip = ipa[i];
+
+    /* Check atmospheric state... */
+    if (iq == IDXP)
+      atm->p[ip] = MIN(MAX(atm->p[ip], 5e-7), 5e4);
+    else if (iq == IDXT)
+      atm->t[ip] = MIN(MAX(atm->t[ip], 100), 400);
+    else if (iq >= IDXQ(0) && iq < IDXQ(ctl->ng))
+      atm->q[iq - IDXQ(0)][ip] = MIN(MAX(atm->q[iq - IDXQ(0)][ip], 0), 1);
+    else if (iq >= IDXK(0) && iq < IDXK(ctl->nw))
+      atm->k[iq - IDXK(0)][ip] = MAX(atm->k[iq - IDXK(0)][ip], 0);
+    else if (iq == IDXCLZ)
+      atm->clz = MAX(atm->clz, 0);
+    else if (iq == IDXCLDZ)
+      atm->cldz = MAX(atm->cldz, 0.1);
+    else if (iq >= IDXCLK(0) && iq < IDXCLK(ctl->ncl))
+      atm->clk[iq - IDXCLK(0)] = MAX(atm->clk[iq - IDXCLK(0)], 0);
+    else if (iq == IDXSFT)
+      atm->sft = MIN(MAX(atm->sft, 100), 400);
+    else if (iq >= IDXSFEPS(0) && iq < IDXSFEPS(ctl->nsf))
+      atm->sfeps[iq - IDXSFEPS(0)] =
+	MIN(MAX(atm->sfeps[iq - IDXSFEPS(0)], 0), 1);
+  }
+}
+
+/*****************************************************************************/
+
+void cnt_alloc(
+  void) {
+
+  static int init = 0;
+
+  /* Allocate... */
+  ALLOC(cnt_local, cnt_t, 1);
+
+  /* Add to list of threads... */
+#pragma omp critical (cnt)
+  {
+    cnt_local->next = cnt_threads;
+    cnt_threads = cnt_local;
+    if (!init) {
+      init = 1;
+      atexit(cnt_write);
+    }
+  }
+}
+
+/*****************************************************************************/
+
+void cnt_los(
+  const int np) {
+
+  /* Allocate... */
+  if (cnt_local == NULL)
+    cnt_alloc();
+
+  /* Count ray path and LOS points... */
+  cnt_local->n[CNT_RAY]++;
+  cnt_local->n[CNT_LOS] += np;
+
+  /* Update histogram... */
+  int ih = 0;
+  while (ih < CNTNH - 1 && (np >> (ih + 1)) > 0)
+    ih++;
+  cnt_local->hist[ih]++;
+}
+
+/*****************************************************************************/
+
+void cnt_write(
+  void) {
+
+  long n[CNT_N] = { 0 }, hist[CNTNH] = { 0 };
+
+  /* Sum up counters of all threads... */
+  for (cnt_t * c = cnt_threads; c != NULL; c = c->next) {
+    for (int i = 0; i < CNT_N; i++)
+      n[i] += c->n[i];
+    for (int ih = 0; ih < CNTNH; ih++)
+      hist[ih] += c->hist[ih];
+  }
+
+  /* Write info... */
+  LOG(1, "\nEvent counters:");
+  LOG(2, "intpol_tbl_eps: %ld calls | u < u_min: %ld (%.3g%%)"
+      " | u > u_max: %ld (%.3g%%)", n[CNT_EPS], n[CNT_EPS_LOW],
+      100. * (double) n[CNT_EPS_LOW] / (double) MAX(n[CNT_EPS], 1),
+      n[CNT_EPS_HIGH],
+      100. * (double) n[CNT_EPS_HIGH] / (double) MAX(n[CNT_EPS], 1));
+  LOG(2, "intpol_tbl_u: %ld calls | eps < eps_min: %ld (%.3g%%)"
+      " | eps > eps_max: %ld (%.3g%%)", n[CNT_U], n[CNT_U_LOW],
+      100. * (double) n[CNT_U_LOW] / (double) MAX(n[CNT_U], 1),
+      n[CNT_U_HIGH],
+      100. * (double) n[CNT_U_HIGH] / (double) MAX(n[CNT_U], 1));
+  LOG(2, "Emissivity set to zero: %ld (np < 30) | %ld (nt < 2 or nu < 2)",
+      n[CNT_TBL_NP], n[CNT_TBL_NT]);
+  LOG(2, "Ray paths: %ld | LOS points: %ld | mean: %.1f per ray",
+      n[CNT_RAY], n[CNT_LOS],
+      (double) n[CNT_LOS] / (double) MAX(n[CNT_RAY], 1));
+  for (int ih = 0; ih < CNTNH; ih++)
+    if (hist[ih] > 0) {
+      if (ih < CNTNH - 1) {
+	LOG(2, "LOS points %ld ... %ld: %ld rays (%.3g%%)",
+	    ih > 0 ? 1L << ih : 0L, (1L << (ih + 1)) - 1, hist[ih],
+	    100. * (double) hist[ih] / (double) MAX(n[CNT_RAY], 1));
+      } else {
+	LOG(2, "LOS points >= %ld: %ld rays (%.3g%%)", 1L << ih, hist[ih],
+	    100. * (double) hist[ih] / (double) MAX(n[CNT_RAY], 1));
+      }
+    }
 }
 
 /*****************************************************************************/
@@ -3264,6 +3613,9 @@ void copy_atm(
   /* Data size... */
   const size_t s = (size_t) atm_src->np * sizeof(double);
 
+  /* Allocate... */
+  alloc_atm(ctl, atm_dest, atm_src->np);
+
   /* Copy data... */
   atm_dest->np = atm_src->np;
   memcpy(atm_dest->time, atm_src->time, s);
@@ -3314,6 +3666,9 @@ void copy_obs(
   /* Data size... */
   const size_t s = (size_t) obs_src->nr * sizeof(double);
 
+  /* Allocate... */
+  alloc_obs(ctl, obs_dest, obs_src->nr);
+
   /* Copy data... */
   obs_dest->nr = obs_src->nr;
   memcpy(obs_dest->time, obs_src->time, s);
@@ -3393,6 +3748,19 @@ void doy2day(
 
 /*****************************************************************************/
 
+void error_exit(
+  void) {
+
+  /* Return to error handler of the calling thread... */
+  if (err_jmp != NULL)
+    longjmp(*err_jmp, 1);
+
+  /* Exit... */
+  exit(EXIT_FAILURE);
+}
+
+/*****************************************************************************/
+
 int find_emitter(
   const ctl_t *ctl,
   const char *emitter) {
@@ -3414,22 +3782,51 @@ void formod(
 
   int *mask;
 
+  PROF_START(formod);
+
   /* Allocate... */
   ALLOC(mask, int,
-	ND * NR);
+	ctl->nd * obs->nr);
 
   /* Save observation mask... */
   for (int id = 0; id < ctl->nd; id++)
     for (int ir = 0; ir < obs->nr; ir++)
-      mask[id * NR + ir] = !isfinite(obs->rad[id][ir]);
+      mask[id * obs->nr + ir] = !isfinite(obs->rad[id][ir]);
 
   /* Hydrostatic equilibrium... */
   hydrostatic(ctl, atm);
 
   /* CGA or EGA forward model... */
-  if (ctl->formod == 0 || ctl->formod == 1)
+  if (ctl->formod == 0 || ctl->formod == 1) {
+
+    /* Find rays with identical geometry... */
+    int *ref;
+    ALLOC(ref, int,
+	  obs->nr);
+    const int nu = formod_dedup(ctl, obs, ref);
+    LOG(3, "Unique ray paths: %d of %d (%d saved)", nu, obs->nr,
+	obs->nr - nu);
+
+    /* Compute unique rays... */
+    for (int ir = 0; ir < obs->nr; ir++)
+      if (ref[ir] == ir)
+	formod_pencil(ctl, tbl, atm, obs, ir);
+
+    /* Copy results to duplicate rays... */
     for (int ir = 0; ir < obs->nr; ir++)
-      formod_pencil(ctl, tbl, atm, obs, ir);
+      if (ref[ir] != ir) {
+	for (int id = 0; id < ctl->nd; id++) {
+	  obs->rad[id][ir] = obs->rad[id][ref[ir]];
+	  obs->tau[id][ir] = obs->tau[id][ref[ir]];
+	}
+	obs->tpz[ir] = obs->tpz[ref[ir]];
+	obs->tplon[ir] = obs->tplon[ref[ir]];
+	obs->tplat[ir] = obs->tplat[ref[ir]];
+      }
+
+    /* Free... */
+    free(ref);
+  }
 
   /* Call RFM... */
   else if (ctl->formod == 2)
@@ -3447,11 +3844,13 @@ void formod(
   /* Apply observation mask... */
   for (int id = 0; id < ctl->nd; id++)
     for (int ir = 0; ir < obs->nr; ir++)
-      if (mask[id * NR + ir])
+      if (mask[id * obs->nr + ir])
 	obs->rad[id][ir] = NAN;
 
   /* Free... */
   free(mask);
+
+  PROF_STOP(formod);
 }
 
 /*****************************************************************************/
@@ -3462,6 +3861,8 @@ void formod_continua(
   const int ip,
   double *beta) {
 
+  PROF_START(formod_continua);
+
   /* Extinction... */
   for (int id = 0; id < ctl->nd; id++)
     beta[id] = los->k[ip][id];
@@ -3488,6 +3889,84 @@ void formod_continua(
   if (ctl->ctm_o2)
     for (int id = 0; id < ctl->nd; id++)
       beta[id] += ctmo2(ctl->nu[id], los->p[ip], los->t[ip]);
+
+  PROF_STOP(formod_continua);
+}
+
+/*****************************************************************************/
+
+int formod_dedup(
+  const ctl_t *ctl,
+  const obs_t *obs,
+  int *ref) {
+
+  double key[7];
+
+  int *head, nu = 0;
+
+  /* Solar zenith angle makes the result depend on time... */
+  const int use_time = (ctl->sftype >= 3 && ctl->sfsza < 0);
+
+  /* Get size of hash table (power of two, load factor <= 0.5)... */
+  size_t nh = 1;
+  while (nh < 2 * (size_t) obs->nr)
+    nh <<= 1;
+
+  /* Allocate... */
+  ALLOC(head, int,
+	nh);
+  for (size_t ih = 0; ih < nh; ih++)
+    head[ih] = -1;
+
+  /* Loop over rays... */
+  for (int ir = 0; ir < obs->nr; ir++) {
+
+    /* Set key (adding zero maps -0.0 to +0.0)... */
+    key[0] = obs->obsz[ir] + 0.0;
+    key[1] = obs->obslon[ir] + 0.0;
+    key[2] = obs->obslat[ir] + 0.0;
+    key[3] = obs->vpz[ir] + 0.0;
+    key[4] = obs->vplon[ir] + 0.0;
+    key[5] = obs->vplat[ir] + 0.0;
+    key[6] = (use_time ? obs->time[ir] + 0.0 : 0.0);
+
+    /* Get FNV-1a hash of key... */
+    uint64_t hash = 14695981039346656037ULL;
+    const unsigned char *bytes = (const unsigned char *) key;
+    for (size_t ib = 0; ib < sizeof(key); ib++) {
+      hash ^= bytes[ib];
+      hash *= 1099511628211ULL;
+    }
+
+    /* Search hash table (linear probing)... */
+    size_t ih = (size_t) (hash & (nh - 1));
+    ref[ir] = ir;
+    while (head[ih] >= 0) {
+      const int jr = head[ih];
+      if (obs->obsz[jr] == obs->obsz[ir]
+	  && obs->obslon[jr] == obs->obslon[ir]
+	  && obs->obslat[jr] == obs->obslat[ir]
+	  && obs->vpz[jr] == obs->vpz[ir]
+	  && obs->vplon[jr] == obs->vplon[ir]
+	  && obs->vplat[jr] == obs->vplat[ir]
+	  && (!use_time || obs->time[jr] == obs->time[ir])) {
+	ref[ir] = jr;
+	break;
+      }
+      ih = (ih + 1) & (nh - 1);
+    }
+
+    /* Insert new ray... */
+    if (ref[ir] == ir) {
+      head[ih] = ir;
+      nu++;
+    }
+  }
+
+  /* Free... */
+  free(head);
+
+  return nu;
 }
 
 /*****************************************************************************/
@@ -3498,12 +3977,14 @@ void formod_fov(
 
   obs_t *obs2;
 
-  double rad[ND][NR], tau[ND][NR], z[NR];
+  double rad[ND][2 * NFOV + 1], tau[ND][2 * NFOV + 1], z[2 * NFOV + 1];
 
   /* Do not take into account FOV... */
   if (ctl->fov[0] == '-')
     return;
 
+  PROF_START(formod_fov);
+
   /* Allocate... */
   ALLOC(obs2, obs_t, 1);
 
@@ -3552,7 +4033,10 @@ void formod_fov(
   }
 
   /* Free... */
+  free_obs(obs2);
   free(obs2);
+
+  PROF_STOP(formod_fov);
 }
 
 /*****************************************************************************/
@@ -3569,6 +4053,8 @@ void formod_pencil(
   double beta_ctm[ND], rad[ND], tau[ND], tau_refl[ND],
     tau_path[ND][NG], tau_gas[ND], x0[3], x1[3];
 
+  PROF_START(formod_pencil);
+
   /* Allocate... */
   ALLOC(los, los_t, 1);
 
@@ -3582,6 +4068,7 @@ void formod_pencil(
 
   /* Raytracing... */
   raytrace(ctl, atm, obs, los, ir);
+  COUNT_LOS(los->np);
 
   /* Loop over LOS points... */
   for (int ip = 0; ip < los->np; ip++) {
@@ -3603,7 +4090,7 @@ void formod_pencil(
       if (tau_gas[id] > 0) {
 
 	/* Get segment emissivity... */
-	los->eps[ip][id] = 1 - tau_gas[id] * exp(-beta_ctm[id] * los->ds[ip]);
+	los->eps[ip][id] = 1 - tau_gas[id] * MEXP(-beta_ctm[id] * los->ds[ip]);
 
 	/* Compute radiance... */
 	rad[id] += los->src[ip][id] * los->eps[ip][id] * tau[id];
@@ -3687,7 +4174,10 @@ void formod_pencil(
   }
 
   /* Free... */
+  free_los(los);
   free(los);
+
+  PROF_STOP(formod_pencil);
 }
 
 /*****************************************************************************/
@@ -3705,12 +4195,14 @@ void formod_rfm(
     rfmflg[LEN] = { "RAD TRA MIX LIN SFC" };
 
   double f[NSHAPE], nu[NSHAPE], nu0, nu1, obsz = -999, tsurf,
-    xd[3], xo[3], xv[3], z[NR], zmin, zmax;
+    xd[3], xo[3], xv[3], *z, zmin, zmax;
 
   int n, nadir = 0;
 
   /* Allocate... */
   ALLOC(los, los_t, 1);
+  ALLOC(z, double,
+	obs->nr);
 
   /* Check observer positions... */
   for (int ir = 1; ir < obs->nr; ir++)
@@ -3828,7 +4320,9 @@ void formod_rfm(
     ERRMSG("Error while removing temporary files!");
 
   /* Free... */
+  free_los(los);
   free(los);
+  free(z);
 }
 
 /*****************************************************************************/
@@ -3844,8 +4338,106 @@ void formod_srcfunc(
 
   /* Interpolate Planck function value... */
   for (int id = 0; id < ctl->nd; id++)
-    src[id] = LIN(tbl->st[it], tbl->sr[it][id],
-		  tbl->st[it + 1], tbl->sr[it + 1][id], t);
+    src[id] = LIN((real_t) tbl->st[it], (real_t) tbl->sr[it][id],
+		  (real_t) tbl->st[it + 1], (real_t) tbl->sr[it + 1][id],
+		  (real_t) t);
+}
+
+/*****************************************************************************/
+
+void free_2d(
+  double **a) {
+
+  if (a != NULL) {
+    free(a[0]);
+    free(a);
+  }
+}
+
+/*****************************************************************************/
+
+void free_atm(
+  atm_t *atm) {
+
+  /* Unmap memory-mapped data... */
+  if (atm->map != NULL) {
+    munmap(atm->map, atm->map_len);
+    free(atm->q);
+    free(atm->k);
+    memset(atm, 0, sizeof(atm_t));
+    return;
+  }
+
+  /* Free... */
+  free(atm->time);
+  free(atm->z);
+  free(atm->lon);
+  free(atm->lat);
+  free(atm->p);
+  free(atm->t);
+  free_2d(atm->q);
+  free_2d(atm->k);
+
+  /* Reset... */
+  memset(atm, 0, sizeof(atm_t));
+}
+
+/*****************************************************************************/
+
+void free_los(
+  los_t *los) {
+
+  /* Free... */
+  free(los->z);
+  free(los->lon);
+  free(los->lat);
+  free(los->p);
+  free(los->t);
+  free(los->ds);
+  free(los->sfeps);
+  free_2d(los->q);
+  free_2d(los->u);
+  free_2d(los->cgp);
+  free_2d(los->cgt);
+  free_2d(los->cgu);
+  free_2d(los->k);
+  free_2d(los->eps);
+  free_2d(los->src);
+
+  /* Reset... */
+  memset(los, 0, sizeof(los_t));
+}
+
+/*****************************************************************************/
+
+void free_obs(
+  obs_t *obs) {
+
+  /* Unmap memory-mapped data... */
+  if (obs->map != NULL) {
+    munmap(obs->map, obs->map_len);
+    free(obs->tau);
+    free(obs->rad);
+    memset(obs, 0, sizeof(obs_t));
+    return;
+  }
+
+  /* Free... */
+  free(obs->time);
+  free(obs->obsz);
+  free(obs->obslon);
+  free(obs->obslat);
+  free(obs->vpz);
+  free(obs->vplon);
+  free(obs->vplat);
+  free(obs->tpz);
+  free(obs->tplon);
+  free(obs->tplat);
+  free_2d(obs->tau);
+  free_2d(obs->rad);
+
+  /* Reset... */
+  memset(obs, 0, sizeof(obs_t));
 }
 
 /*****************************************************************************/
@@ -4058,6 +4650,8 @@ void intpol_tbl_cga(
 
   double eps;
 
+  PROF_START(intpol_tbl_cga);
+
   /* Loop over channels... */
   for (int id = 0; id < ctl->nd; id++) {
 
@@ -4068,8 +4662,11 @@ void intpol_tbl_cga(
     for (int ig = 0; ig < ctl->ng; ig++) {
 
       /* Check size of table (pressure) and column density... */
-      if (tbl->np[id][ig] < 30 || los->cgu[ip][ig] <= 0)
+      if (tbl->np[id][ig] < 30 || los->cgu[ip][ig] <= 0) {
+	if (tbl->np[id][ig] < 30)
+	  COUNT(CNT_TBL_NP);
 	eps = 0;
+      }
 
       /* Check transmittance... */
       else if (tau_path[id][ig] < 1e-9)
@@ -4092,37 +4689,39 @@ void intpol_tbl_cga(
 	    || tbl->nu[id][ig][ipr][it0] < 2
 	    || tbl->nu[id][ig][ipr][it0 + 1] < 2
 	    || tbl->nu[id][ig][ipr + 1][it1] < 2
-	    || tbl->nu[id][ig][ipr + 1][it1 + 1] < 2)
+	    || tbl->nu[id][ig][ipr + 1][it1 + 1] < 2) {
+	  COUNT(CNT_TBL_NT);
 	  eps = 0;
+	}
 
 	else {
 
+	  /* Get Curtis-Godson means in working precision... */
+	  const real_t cgp = (real_t) los->cgp[ip][ig];
+	  const real_t cgt = (real_t) los->cgt[ip][ig];
+	  const real_t cgu = (real_t) los->cgu[ip][ig];
+
 	  /* Get emissivities of extended path... */
-	  double eps00
-	    = intpol_tbl_eps(tbl, ig, id, ipr, it0, los->cgu[ip][ig]);
-	  double eps01 =
-	    intpol_tbl_eps(tbl, ig, id, ipr, it0 + 1, los->cgu[ip][ig]);
-	  double eps10 =
-	    intpol_tbl_eps(tbl, ig, id, ipr + 1, it1, los->cgu[ip][ig]);
-	  double eps11 =
-	    intpol_tbl_eps(tbl, ig, id, ipr + 1, it1 + 1, los->cgu[ip][ig]);
+	  real_t eps00 = intpol_tbl_eps(tbl, ig, id, ipr, it0, cgu);
+	  real_t eps01 = intpol_tbl_eps(tbl, ig, id, ipr, it0 + 1, cgu);
+	  real_t eps10 = intpol_tbl_eps(tbl, ig, id, ipr + 1, it1, cgu);
+	  real_t eps11 = intpol_tbl_eps(tbl, ig, id, ipr + 1, it1 + 1, cgu);
 
 	  /* Interpolate with respect to temperature... */
-	  eps00 = LIN(tbl->t[id][ig][ipr][it0], eps00,
-		      tbl->t[id][ig][ipr][it0 + 1], eps01, los->cgt[ip][ig]);
-	  eps11 = LIN(tbl->t[id][ig][ipr + 1][it1], eps10,
-		      tbl->t[id][ig][ipr + 1][it1 + 1],
-		      eps11, los->cgt[ip][ig]);
+	  eps00 = LIN((real_t) tbl->t[id][ig][ipr][it0], eps00,
+		      (real_t) tbl->t[id][ig][ipr][it0 + 1], eps01, cgt);
+	  eps11 = LIN((real_t) tbl->t[id][ig][ipr + 1][it1], eps10,
+		      (real_t) tbl->t[id][ig][ipr + 1][it1 + 1], eps11, cgt);
 
 	  /* Interpolate with respect to pressure... */
-	  eps00 = LOGX(tbl->p[id][ig][ipr], eps00,
-		       tbl->p[id][ig][ipr + 1], eps11, los->cgp[ip][ig]);
+	  eps00 = RLOGX((real_t) tbl->p[id][ig][ipr], eps00,
+			(real_t) tbl->p[id][ig][ipr + 1], eps11, cgp);
 
 	  /* Check emissivity range... */
 	  eps00 = MAX(MIN(eps00, 1), 0);
 
 	  /* Determine segment emissivity... */
-	  eps = 1 - (1 - eps00) / tau_path[id][ig];
+	  eps = 1 - (1 - (double) eps00) / tau_path[id][ig];
 	}
       }
 
@@ -4133,6 +4732,8 @@ void intpol_tbl_cga(
       tau_seg[id] *= (1 - eps);
     }
   }
+
+  PROF_STOP(intpol_tbl_cga);
 }
 
 /*****************************************************************************/
@@ -4145,7 +4746,11 @@ void intpol_tbl_ega(
   double tau_path[ND][NG],
   double tau_seg[ND]) {
 
-  double eps, u;
+  double eps;
+
+  real_t u;
+
+  PROF_START(intpol_tbl_ega);
 
   /* Loop over channels... */
   for (int id = 0; id < ctl->nd; id++) {
@@ -4157,8 +4762,11 @@ void intpol_tbl_ega(
     for (int ig = 0; ig < ctl->ng; ig++) {
 
       /* Check size of table (pressure) and column density... */
-      if (tbl->np[id][ig] < 30 || los->cgu[ip][ig] <= 0)
+      if (tbl->np[id][ig] < 30 || los->cgu[ip][ig] <= 0) {
+	if (tbl->np[id][ig] < 30)
+	  COUNT(CNT_TBL_NP);
 	eps = 0;
+      }
 
       /* Check transmittance... */
       else if (tau_path[id][ig] < 1e-9)
@@ -4181,44 +4789,48 @@ void intpol_tbl_ega(
 	    || tbl->nu[id][ig][ipr][it0] < 2
 	    || tbl->nu[id][ig][ipr][it0 + 1] < 2
 	    || tbl->nu[id][ig][ipr + 1][it1] < 2
-	    || tbl->nu[id][ig][ipr + 1][it1 + 1] < 2)
+	    || tbl->nu[id][ig][ipr + 1][it1 + 1] < 2) {
+	  COUNT(CNT_TBL_NT);
 	  eps = 0;
+	}
 
 	else {
 
+	  /* Get path emissivity and segment data in working precision... */
+	  const real_t eps_path = (real_t) (1 - tau_path[id][ig]);
+	  const real_t p = (real_t) los->p[ip];
+	  const real_t t = (real_t) los->t[ip];
+	  const real_t useg = (real_t) los->u[ip][ig];
+
 	  /* Get emissivities of extended path... */
-	  u = intpol_tbl_u(tbl, ig, id, ipr, it0, 1 - tau_path[id][ig]);
-	  double eps00
-	    = intpol_tbl_eps(tbl, ig, id, ipr, it0, u + los->u[ip][ig]);
+	  u = intpol_tbl_u(tbl, ig, id, ipr, it0, eps_path);
+	  real_t eps00 = intpol_tbl_eps(tbl, ig, id, ipr, it0, u + useg);
 
-	  u = intpol_tbl_u(tbl, ig, id, ipr, it0 + 1, 1 - tau_path[id][ig]);
-	  double eps01 =
-	    intpol_tbl_eps(tbl, ig, id, ipr, it0 + 1, u + los->u[ip][ig]);
+	  u = intpol_tbl_u(tbl, ig, id, ipr, it0 + 1, eps_path);
+	  real_t eps01 = intpol_tbl_eps(tbl, ig, id, ipr, it0 + 1, u + useg);
 
-	  u = intpol_tbl_u(tbl, ig, id, ipr + 1, it1, 1 - tau_path[id][ig]);
-	  double eps10 =
-	    intpol_tbl_eps(tbl, ig, id, ipr + 1, it1, u + los->u[ip][ig]);
+	  u = intpol_tbl_u(tbl, ig, id, ipr + 1, it1, eps_path);
+	  real_t eps10 = intpol_tbl_eps(tbl, ig, id, ipr + 1, it1, u + useg);
 
-	  u =
-	    intpol_tbl_u(tbl, ig, id, ipr + 1, it1 + 1, 1 - tau_path[id][ig]);
-	  double eps11 =
-	    intpol_tbl_eps(tbl, ig, id, ipr + 1, it1 + 1, u + los->u[ip][ig]);
+	  u = intpol_tbl_u(tbl, ig, id, ipr + 1, it1 + 1, eps_path);
+	  real_t eps11 =
+	    intpol_tbl_eps(tbl, ig, id, ipr + 1, it1 + 1, u + useg);
 
 	  /* Interpolate with respect to temperature... */
-	  eps00 = LIN(tbl->t[id][ig][ipr][it0], eps00,
-		      tbl->t[id][ig][ipr][it0 + 1], eps01, los->t[ip]);
-	  eps11 = LIN(tbl->t[id][ig][ipr + 1][it1], eps10,
-		      tbl->t[id][ig][ipr + 1][it1 + 1], eps11, los->t[ip]);
+	  eps00 = LIN((real_t) tbl->t[id][ig][ipr][it0], eps00,
+		      (real_t) tbl->t[id][ig][ipr][it0 + 1], eps01, t);
+	  eps11 = LIN((real_t) tbl->t[id][ig][ipr + 1][it1], eps10,
+		      (real_t) tbl->t[id][ig][ipr + 1][it1 + 1], eps11, t);
 
 	  /* Interpolate with respect to pressure... */
-	  eps00 = LIN(tbl->p[id][ig][ipr], eps00,
-		      tbl->p[id][ig][ipr + 1], eps11, los->p[ip]);
+	  eps00 = LIN((real_t) tbl->p[id][ig][ipr], eps00,
+		      (real_t) tbl->p[id][ig][ipr + 1], eps11, p);
 
 	  /* Check emissivity range... */
 	  eps00 = MAX(MIN(eps00, 1), 0);
 
 	  /* Determine segment emissivity... */
-	  eps = 1 - (1 - eps00) / tau_path[id][ig];
+	  eps = 1 - (1 - (double) eps00) / tau_path[id][ig];
 	}
       }
 
@@ -4229,70 +4841,84 @@ void intpol_tbl_ega(
       tau_seg[id] *= (1 - eps);
     }
   }
+
+  PROF_STOP(intpol_tbl_ega);
 }
 
 /*****************************************************************************/
 
-inline double intpol_tbl_eps(
+inline real_t intpol_tbl_eps(
   const tbl_t *tbl,
   const int ig,
   const int id,
   const int ip,
   const int it,
-  const double u) {
+  const real_t u) {
 
   const int nu = tbl->nu[id][ig][ip][it];
   const float *u_arr = tbl->u[id][ig][ip][it];
   const float *eps_arr = tbl->eps[id][ig][ip][it];
 
-  const double u_min = u_arr[0];
-  const double u_max = u_arr[nu - 1];
+  const real_t u_min = u_arr[0];
+  const real_t u_max = u_arr[nu - 1];
+
+  COUNT(CNT_EPS);
 
   /* Lower boundary extrapolation... */
-  if (u < u_min)
+  if (u < u_min) {
+    COUNT(CNT_EPS_LOW);
     return eps_arr[0] * u / u_min;
+  }
 
   /* Upper boundary extrapolation... */
   if (u > u_max) {
-    const double a = log(1.0 - eps_arr[nu - 1]) / u_max;
-    return 1.0 - exp(a * u);
+    COUNT(CNT_EPS_HIGH);
+    const real_t a = RLOG((real_t) 1.0 - eps_arr[nu - 1]) / u_max;
+    return (real_t) 1.0 - REXP(a * u);
   }
 
   /* Interpolation... */
   const int idx = locate_tbl(u_arr, nu, u);
-  return LOGXY(u_arr[idx], eps_arr[idx], u_arr[idx + 1], eps_arr[idx + 1], u);
+  return RLOGXY(u_arr[idx], eps_arr[idx], u_arr[idx + 1], eps_arr[idx + 1],
+		u);
 }
 
 /*****************************************************************************/
 
-inline double intpol_tbl_u(
+inline real_t intpol_tbl_u(
   const tbl_t *tbl,
   const int ig,
   const int id,
   const int ip,
   const int it,
-  const double eps) {
+  const real_t eps) {
 
   const int nu = tbl->nu[id][ig][ip][it];
   const float *eps_arr = tbl->eps[id][ig][ip][it];
   const float *u_arr = tbl->u[id][ig][ip][it];
 
-  const double eps_min = eps_arr[0];
-  const double eps_max = eps_arr[nu - 1];
+  const real_t eps_min = eps_arr[0];
+  const real_t eps_max = eps_arr[nu - 1];
+
+  COUNT(CNT_U);
 
   /* Lower boundary extrapolation... */
-  if (eps < eps_min)
+  if (eps < eps_min) {
+    COUNT(CNT_U_LOW);
     return u_arr[0] * eps / eps_min;
+  }
 
   /* Upper boundary extrapolation... */
   if (eps > eps_max) {
-    const double a = log(1.0 - eps_max) / u_arr[nu - 1];
-    return log(1.0 - eps) / a;
+    COUNT(CNT_U_HIGH);
+    const real_t a = RLOG((real_t) 1.0 - eps_max) / u_arr[nu - 1];
+    return RLOG((real_t) 1.0 - eps) / a;
   }
 
   /* Interpolation... */
   const int idx = locate_tbl(eps_arr, nu, eps);
-  return LOGXY(eps_arr[idx], u_arr[idx], eps_arr[idx + 1], u_arr[idx + 1], eps);
+  return RLOGXY(eps_arr[idx], u_arr[idx], eps_arr[idx + 1], u_arr[idx + 1],
+		eps);
 }
 
 /*****************************************************************************/
@@ -4339,6 +4965,8 @@ void kernel(
 
   int *iqa;
 
+  PROF_START(kernel);
+
   /* Get sizes... */
   const size_t m = k->size1;
   const size_t n = k->size2;
@@ -4347,7 +4975,7 @@ void kernel(
   gsl_vector *x0 = gsl_vector_alloc(n);
   gsl_vector *yy0 = gsl_vector_alloc(m);
   ALLOC(iqa, int,
-	N);
+	n);
 
   /* Compute radiance for undisturbed atmospheric data... */
   formod(ctl, tbl, atm, obs);
@@ -4413,6 +5041,8 @@ void kernel(
     /* Free... */
     gsl_vector_free(x1);
     gsl_vector_free(yy1);
+    free_atm(atm1);
+    free_obs(obs1);
     free(atm1);
     free(obs1);
   }
@@ -4421,6 +5051,31 @@ void kernel(
   gsl_vector_free(x0);
   gsl_vector_free(yy0);
   free(iqa);
+
+  PROF_STOP(kernel);
+}
+
+/*****************************************************************************/
+
+size_t locate_ctlmap(
+  const ctlmap_t *map,
+  const int src,
+  const char *name) {
+
+  /* Get hash value (FNV-1a, case-insensitive)... */
+  uint64_t h = UINT64_C(14695981039346656037) ^ (uint64_t) (src != 0);
+  for (const char *c = name; *c != '\0'; c++) {
+    h ^= (uint64_t) (unsigned char) tolower((unsigned char) *c);
+    h *= UINT64_C(1099511628211);
+  }
+
+  /* Find matching or empty slot (linear probing)... */
+  size_t i = (size_t) h & (map->size - 1);
+  while (map->name[i] != NULL
+	 && (map->src[i] != src || strcasecmp(map->name[i], name) != 0))
+    i = (i + 1) & (map->size - 1);
+
+  return i;
 }
 
 /*****************************************************************************/
@@ -4496,6 +5151,68 @@ inline int locate_tbl(
 
 /*****************************************************************************/
 
+void log_buffer_close(
+  void) {
+
+  /* Check buffer... */
+  if (log_stream == NULL)
+    return;
+
+  /* Close buffer... */
+  FILE *stream = log_stream;
+  log_stream = NULL;
+  fclose(stream);
+
+  /* Write log messages... */
+  pthread_mutex_lock(&log_mutex);
+  printf("%s", log_buf);
+  fflush(stdout);
+  pthread_mutex_unlock(&log_mutex);
+  free(log_buf);
+  log_buf = NULL;
+  log_len = 0;
+}
+
+/*****************************************************************************/
+
+void log_buffer_open(
+  void) {
+
+  /* Open buffer... */
+  if (!(log_stream = open_memstream(&log_buf, &log_len)))
+    ERRMSG("Cannot open log buffer!");
+}
+
+/*****************************************************************************/
+
+void matrix_inv_chol(
+  gsl_matrix *a) {
+
+#ifdef LAPACK
+
+  /* Cholesky decomposition (row-major lower = column-major upper)... */
+  const int n = (int) a->size1, lda = (int) a->tda;
+  int info;
+  dpotrf_("U", &n, a->data, &lda, &info);
+  if (info != 0)
+    ERRMSG("Cholesky decomposition failed!");
+
+  /* Invert triangular factor... */
+  dtrtri_("U", "N", &n, a->data, &lda, &info);
+  if (info != 0)
+    ERRMSG("Triangular matrix inversion failed!");
+
+#else
+
+  /* Cholesky decomposition and inversion of triangular factor... */
+  gsl_linalg_cholesky_decomp1(a);
+  gsl_linalg_tri_invert(CblasLower, CblasNonUnit, a);
+
+#endif
+}
+
+/*****************************************************************************/
+
 void matrix_invert(
   gsl_matrix *a) {
 
@@ -4519,8 +5236,25 @@ void matrix_invert(
 
   /* Matrix inversion by means of Cholesky decomposition... */
   else {
+#ifdef LAPACK
+    /* Row-major lower triangle is column-major upper triangle... */
+    const int nn = (int) n, lda = (int) a->tda;
+    int info;
+    dpotrf_("U", &nn, a->data, &lda, &info);
+    if (info != 0)
+      ERRMSG("Cholesky decomposition failed!");
+    dpotri_("U", &nn, a->data, &lda, &info);
+    if (info != 0)
+      ERRMSG("Matrix inversion failed!");
+
+    /* Copy lower to upper triangle... */
+    for (size_t i = 0; i < n; i++)
+      for (size_t j = i + 1; j < n; j++)
+	a->data[i * a->tda + j] = a->data[j * a->tda + i];
+#else
     gsl_linalg_cholesky_decomp(a);
     gsl_linalg_cholesky_invert(a);
+#endif
   }
 }
 
@@ -4532,6 +5266,8 @@ void matrix_product(
   const int transpose,
   gsl_matrix *c) {
 
+  PROF_START(matrix_product);
+
   /* Set sizes... */
   const size_t m = a->size1;
   const size_t n = a->size2;
@@ -4542,31 +5278,88 @@ void matrix_product(
   /* Compute A^T B A... */
   if (transpose == 1) {
 
-    /* Compute B^1/2 A... */
-    for (size_t i = 0; i < m; i++)
+    /* Compute B^1/2 A (scale rows)... */
+    for (size_t i = 0; i < m; i++) {
+      const double bi = b->data[i * b->stride];
+      const double *restrict ai = a->data + i * a->tda;
+      double *restrict auxi = aux->data + i * aux->tda;
       for (size_t j = 0; j < n; j++)
-	gsl_matrix_set(aux, i, j,
-		       gsl_vector_get(b, i) * gsl_matrix_get(a, i, j));
+	auxi[j] = bi * ai[j];
+    }
 
-    /* Compute A^T B A = (B^1/2 A)^T (B^1/2 A)... */
-    gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, aux, aux, 0.0, c);
+    /* Compute A^T B A = (B^1/2 A)^T (B^1/2 A) (lower triangle)... */
+    gsl_blas_dsyrk(CblasLower, CblasTrans, 1.0, aux, 0.0, c);
   }
 
   /* Compute A B A^T... */
   else if (transpose == 2) {
 
-    /* Compute A B^1/2... */
-    for (size_t i = 0; i < m; i++)
-      for (size_t j = 0; j < n; j++)
-	gsl_matrix_set(aux, i, j,
-		       gsl_matrix_get(a, i, j) * gsl_vector_get(b, j));
+    /* Compute A B^1/2 (scale columns)... */
+    for (size_t i = 0; i < m; i++) {
+      const double *restrict ai = a->data + i * a->tda;
+      double *restrict auxi = aux->data + i * aux->tda;
+      if (b->stride == 1) {
+	const double *restrict bd = b->data;
+	for (size_t j = 0; j < n; j++)
+	  auxi[j] = ai[j] * bd[j];
+      } else
+	for (size_t j = 0; j < n; j++)
+	  auxi[j] = ai[j] * b->data[j * b->stride];
+    }
+
+    /* Compute A B A^T = (A B^1/2) (A B^1/2)^T (lower triangle)... */
+    gsl_blas_dsyrk(CblasLower, CblasNoTrans, 1.0, aux, 0.0, c);
+  }
 
-    /* Compute A B A^T = (A B^1/2) (A B^1/2)^T... */
-    gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, aux, aux, 0.0, c);
+  /* Copy lower to upper triangle... */
+  if (transpose == 1 || transpose == 2) {
+    const size_t nc = c->size1;
+    for (size_t i = 0; i < nc; i++)
+      for (size_t j = i + 1; j < nc; j++)
+	c->data[i * c->tda + j] = c->data[j * c->tda + i];
   }
 
   /* Free... */
   gsl_matrix_free(aux);
+
+  PROF_STOP(matrix_product);
+}
+
+/*****************************************************************************/
+
+void matrix_solve(
+  gsl_matrix *a,
+  const gsl_vector *b,
+  gsl_vector *x) {
+
+#ifdef LAPACK
+
+  /* Check vector... */
+  if (x->stride != 1)
+    ERRMSG("Solution vector must have unit stride!");
+
+  /* Copy right-hand side... */
+  gsl_vector_memcpy(x, b);
+
+  /* Cholesky decomposition (row-major lower = column-major upper)... */
+  const int n = (int) a->size1, lda = (int) a->tda, nrhs = 1;
+  int info;
+  dpotrf_("U", &n, a->data, &lda, &info);
+  if (info != 0)
+    ERRMSG("Cholesky decomposition failed!");
+
+  /* Solve linear system... */
+  dpotrs_("U", &n, &nrhs, a->data, &lda, x->data, &n, &info);
+  if (info != 0)
+    ERRMSG("Solving linear system failed!");
+
+#else
+
+  /* Solve by means of GSL Cholesky decomposition... */
+  gsl_linalg_cholesky_decomp(a);
+  gsl_linalg_cholesky_solve(a, b, x);
+
+#endif
 }
 
 /*****************************************************************************/
@@ -4599,33 +5392,54 @@ size_t obs2y(
 /*****************************************************************************/
 
 void optimal_estimation(
-  ret_t *ret,
-  ctl_t *ctl,
-  tbl_t *tbl,
+  const ret_t *ret,
+  const ctl_t *ctl,
+  const tbl_t *tbl,
   obs_t *obs_meas,
   obs_t *obs_i,
   atm_t *atm_apr,
   atm_t *atm_i,
-  double *chisq) {
+  double *chisq,
+  warm_t *warm) {
+
+  int *ipa, *iqa, conv = 0, warm_atm = 0, warm_k = 0;
 
-  static int ipa[N], iqa[N];
+  size_t *blk, nblk = 0;
 
   double disq = 0, lmpar = 0.001;
 
+  int kernel_exact = 1, kernel_stall = 0;
+
   /* ------------------------------------------------------------
      Initialize...
      ------------------------------------------------------------ */
 
   /* Get sizes... */
   const size_t m = obs2y(ctl, obs_meas, NULL, NULL, NULL);
-  const size_t n = atm2x(ctl, atm_apr, NULL, iqa, ipa);
+  const size_t n = atm2x(ctl, atm_apr, NULL, NULL, NULL);
   if (m == 0 || n == 0) {
     WARN("Check problem definition (m = 0 or n = 0)!");
     *chisq = GSL_NAN;
     return;
   }
 
+  PROF_START(optimal_estimation);
+
   /* Allocate... */
+  ALLOC(ipa, int,
+	n);
+  ALLOC(iqa, int,
+	n);
+  atm2x(ctl, atm_apr, NULL, iqa, ipa);
+  ALLOC(blk, size_t,
+	n + 1);
+
+  /* Get blocks of state vector elements of the same quantity... */
+  for (size_t i = 0; i < n; i++)
+    if (i == 0 || iqa[i] != iqa[i - 1])
+      blk[nblk++] = i;
+  blk[nblk] = n;
+
   gsl_matrix *a = gsl_matrix_alloc(n, n);
   gsl_matrix *cov = gsl_matrix_alloc(n, n);
   gsl_matrix *k_i = gsl_matrix_alloc(m, n);
@@ -4644,8 +5458,19 @@ void optimal_estimation(
   gsl_vector *y_i = gsl_vector_alloc(m);
   gsl_vector *y_m = gsl_vector_alloc(m);
 
+  /* Check warm-start data... */
+  if (warm != NULL && warm->ok)
+    warm_check(ret, ctl, warm, atm_apr, obs_meas, &warm_atm, &warm_k);
+
   /* Set initial state... */
   copy_atm(ctl, atm_i, atm_apr, 0);
+  if (warm_atm) {
+    atm2x(ctl, &warm->atm, x_i, NULL, NULL);
+    x2atm(ctl, x_i, atm_i);
+    lmpar = warm->lmpar;
+    LOG(2, "Warm start from previous retrieval (kernel: %s)...",
+	warm_k ? "yes" : "no");
+  }
   copy_obs(ctl, obs_i, obs_meas, 0);
   formod(ctl, tbl, atm_i, obs_i);
 
@@ -4653,13 +5478,21 @@ void optimal_estimation(
   atm2x(ctl, atm_apr, x_a, NULL, NULL);
   atm2x(ctl, atm_i, x_i, NULL, NULL);
   obs2y(ctl, obs_meas, y_m, NULL, NULL);
-  obs2y(ctl, obs_i, y_i, NULL, NULL);
+  if (obs2y(ctl, obs_i, y_i, NULL, NULL) != m)
+    ERRMSG("Forward model returned invalid radiances!");
 
   /* Set inverse a priori covariance S_a^-1... */
   set_cov_apr(ret, ctl, atm_apr, iqa, ipa, s_a_inv);
-  write_matrix(ret->dir, "matrix_cov_apr.tab", ctl, s_a_inv,
-	       atm_i, obs_i, "x", "x", "r");
-  matrix_invert(s_a_inv);
+  write_matrix_async(ret->dir, "matrix_cov_apr.tab", ctl, s_a_inv, atm_i,
+		     obs_i, "x", "x", "r");
+
+  /* Invert S_a block by block (quantities are uncorrelated)... */
+  for (size_t ib = 0; ib < nblk; ib++) {
+    const size_t nb = blk[ib + 1] - blk[ib];
+    gsl_matrix_view s_a_blk =
+      gsl_matrix_submatrix(s_a_inv, blk[ib], blk[ib], nb, nb);
+    matrix_invert(&s_a_blk.matrix);
+  }
 
   /* Get measurement errors... */
   set_cov_meas(ret, ctl, obs_meas, sig_noise, sig_formod, sig_eps_inv);
@@ -4676,8 +5509,12 @@ void optimal_estimation(
   /* Write info... */
   LOG(2, "it= %d / chi^2/m= %g", 0, *chisq);
 
-  /* Compute initial kernel... */
-  kernel(ctl, tbl, atm_i, obs_i, k_i);
+  /* Compute initial kernel (a warm-start kernel is only approximate)... */
+  if (warm_k) {
+    gsl_matrix_memcpy(k_i, warm->k);
+    kernel_exact = 0;
+  } else
+    kernel(ctl, tbl, atm_i, obs_i, k_i);
 
   /* ------------------------------------------------------------
      Levenberg-Marquardt minimization...
@@ -4689,12 +5526,20 @@ void optimal_estimation(
     /* Store current cost function value... */
     double chisq_old = *chisq;
 
+    /* Check if kernel matrix needs to be recomputed... */
+    const int recomp = (ret->kernel_broyden ? it > 1 && kernel_stall
+			: it > 1 && (kernel_stall
+				     || it % ret->kernel_recomp == 0));
+
     /* Compute kernel matrix K_i... */
-    if (it > 1 && it % ret->kernel_recomp == 0)
+    if (recomp) {
       kernel(ctl, tbl, atm_i, obs_i, k_i);
+      kernel_exact = 1;
+      kernel_stall = 0;
+    }
 
     /* Compute K_i^T * S_eps^{-1} * K_i ... */
-    if (it == 1 || it % ret->kernel_recomp == 0)
+    if (it == 1 || recomp || ret->kernel_broyden)
       matrix_product(k_i, sig_eps_inv, 1, cov);
 
     /* Determine b = K_i^T * S_eps^{-1} * dy - S_a^{-1} * dx ... */
@@ -4702,46 +5547,58 @@ void optimal_estimation(
       gsl_vector_set(y_aux, i, gsl_vector_get(dy, i)
 		     * POW2(gsl_vector_get(sig_eps_inv, i)));
     gsl_blas_dgemv(CblasTrans, 1.0, k_i, y_aux, 0.0, b);
-    gsl_blas_dgemv(CblasNoTrans, -1.0, s_a_inv, dx, 1.0, b);
+    for (size_t ib = 0; ib < nblk; ib++) {
+      const size_t nb = blk[ib + 1] - blk[ib];
+      gsl_matrix_const_view s_a_blk =
+	gsl_matrix_const_submatrix(s_a_inv, blk[ib], blk[ib], nb, nb);
+      gsl_vector_const_view dx_blk =
+	gsl_vector_const_subvector(dx, blk[ib], nb);
+      gsl_vector_view b_blk = gsl_vector_subvector(b, blk[ib], nb);
+      gsl_blas_dgemv(CblasNoTrans, -1.0, &s_a_blk.matrix, &dx_blk.vector,
+		     1.0, &b_blk.vector);
+    }
+
+    /* Store dy for kernel update... */
+    const int step_exact = kernel_exact;
+    int accept = 0;
+    gsl_vector_memcpy(y_aux, dy);
 
     /* Inner loop... */
     for (int it2 = 0; it2 < 20; it2++) {
 
-      /* Compute A = (1 + lmpar) * S_a^{-1} + K_i^T * S_eps^{-1} * K_i ... */
-      gsl_matrix_memcpy(a, s_a_inv);
-      gsl_matrix_scale(a, 1 + lmpar);
-      gsl_matrix_add(a, cov);
+      /* Compute A = (1 + lmpar) * S_a^{-1} + K_i^T * S_eps^{-1} * K_i
+         (lower triangle only, S_a^{-1} is block-diagonal)... */
+      for (size_t i = 0; i < n; i++)
+	memcpy(a->data + i * a->tda, cov->data + i * cov->tda,
+	       (i + 1) * sizeof(double));
+      for (size_t ib = 0; ib < nblk; ib++)
+	for (size_t i = blk[ib]; i < blk[ib + 1]; i++) {
+	  double *restrict ai = a->data + i * a->tda;
+	  const double *restrict si = s_a_inv->data + i * s_a_inv->tda;
+	  for (size_t j = blk[ib]; j <= i; j++)
+	    ai[j] += (1 + lmpar) * si[j];
+	}
 
       /* Solve A * x_step = b by means of Cholesky decomposition... */
-      gsl_linalg_cholesky_decomp(a);
-      gsl_linalg_cholesky_solve(a, b, x_step);
+      matrix_solve(a, b, x_step);
 
-      /* Update atmospheric state... */
+      /* Update retrieved elements of atmospheric state in place... */
       gsl_vector_add(x_i, x_step);
-      copy_atm(ctl, atm_i, atm_apr, 0);
-      copy_obs(ctl, obs_i, obs_meas, 0);
       x2atm(ctl, x_i, atm_i);
+      clamp_atm(ctl, atm_i, iqa, ipa, n);
 
-      /* Check atmospheric state... */
-      for (int ip = 0; ip < atm_i->np; ip++) {
-	atm_i->p[ip] = MIN(MAX(atm_i->p[ip], 5e-7), 5e4);
-	atm_i->t[ip] = MIN(MAX(atm_i->t[ip], 100), 400);
-	for (int ig = 0; ig < ctl->ng; ig++)
-	  atm_i->q[ig][ip] = MIN(MAX(atm_i->q[ig][ip], 0), 1);
-	for (int iw = 0; iw < ctl->nw; iw++)
-	  atm_i->k[iw][ip] = MAX(atm_i->k[iw][ip], 0);
-      }
-      atm_i->clz = MAX(atm_i->clz, 0);
-      atm_i->cldz = MAX(atm_i->cldz, 0.1);
-      for (int icl = 0; icl < ctl->ncl; icl++)
-	atm_i->clk[icl] = MAX(atm_i->clk[icl], 0);
-      atm_i->sft = MIN(MAX(atm_i->sft, 100), 400);
-      for (int isf = 0; isf < ctl->nsf; isf++)
-	atm_i->sfeps[isf] = MIN(MAX(atm_i->sfeps[isf], 0), 1);
+      /* Restore measurement mask (formod keeps non-finite radiances)... */
+      for (int ir = 0; ir < obs_i->nr; ir++)
+	for (int id = 0; id < ctl->nd; id++)
+	  if (!isfinite(obs_meas->rad[id][ir]))
+	    obs_i->rad[id][ir] = NAN;
+	  else if (!isfinite(obs_i->rad[id][ir]))
+	    obs_i->rad[id][ir] = 0;
 
       /* Forward calculation... */
       formod(ctl, tbl, atm_i, obs_i);
-      obs2y(ctl, obs_i, y_i, NULL, NULL);
+      if (obs2y(ctl, obs_i, y_i, NULL, NULL) != m)
+	ERRMSG("Forward model returned invalid radiances!");
 
       /* Determine dx = x_i - x_a and dy = y - F(x_i) ... */
       gsl_vector_memcpy(dx, x_i);
@@ -4758,10 +5615,39 @@ void optimal_estimation(
 	gsl_vector_sub(x_i, x_step);
       } else {
 	lmpar /= 10;
+	accept = 1;
 	break;
       }
     }
 
+    /* Roll back to previous state if no step was accepted... */
+    if (!accept) {
+      x2atm(ctl, x_i, atm_i);
+      clamp_atm(ctl, atm_i, iqa, ipa, n);
+      hydrostatic(ctl, atm_i);
+      gsl_vector_memcpy(dx, x_i);
+      gsl_vector_sub(dx, x_a);
+      gsl_vector_memcpy(dy, y_aux);
+      gsl_vector_memcpy(y_i, y_m);
+      gsl_vector_sub(y_i, dy);
+      y2obs(ctl, y_i, obs_i);
+      *chisq = chisq_old;
+    }
+
+    /* Update kernel matrix by means of Broyden's method...
+       K_i += (dy_old - dy - K_i * x_step) * x_step^T / |x_step|^2 */
+    if (ret->kernel_broyden) {
+      double ss;
+      gsl_blas_ddot(x_step, x_step, &ss);
+      if (accept && ss > 0) {
+	gsl_vector_sub(y_aux, dy);
+	gsl_blas_dgemv(CblasNoTrans, -1.0, k_i, x_step, 1.0, y_aux);
+	gsl_blas_dger(1 / ss, y_aux, x_step, k_i);
+	kernel_exact = 0;
+      } else
+	kernel_stall = 1;
+    }
+
     /* Write info... */
     LOG(2, "it= %d / chi^2/m= %g", it, *chisq);
 
@@ -4769,9 +5655,34 @@ void optimal_estimation(
     gsl_blas_ddot(x_step, b, &disq);
     disq /= (double) n;
 
-    /* Convergence test... */
-    if ((it == 1 || it % ret->kernel_recomp == 0) && disq < ret->conv_dmin)
-      break;
+    /* Convergence test (confirm with exact kernel)... */
+    if ((ret->kernel_broyden || it == 1 || recomp)
+	&& disq < ret->conv_dmin) {
+      if (step_exact) {
+	conv = 1;
+	break;
+      }
+      kernel_stall = 1;
+    }
+  }
+
+  /* Recompute approximate kernel at final state... */
+  if (!kernel_exact && (ret->err_ana || warm != NULL))
+    kernel(ctl, tbl, atm_i, obs_i, k_i);
+
+  /* Store warm-start data... */
+  if (warm != NULL && conv) {
+    copy_atm(ctl, &warm->atm, atm_i, 0);
+    copy_obs(ctl, &warm->obs, obs_meas, 0);
+    if (warm->k != NULL && (warm->k->size1 != m || warm->k->size2 != n)) {
+      gsl_matrix_free(warm->k);
+      warm->k = NULL;
+    }
+    if (warm->k == NULL)
+      warm->k = gsl_matrix_alloc(m, n);
+    gsl_matrix_memcpy(warm->k, k_i);
+    warm->lmpar = lmpar;
+    warm->ok = 1;
   }
 
   /* ------------------------------------------------------------
@@ -4782,67 +5693,171 @@ void optimal_estimation(
   if (ret->err_ana) {
 
     /* Store results... */
-    write_atm(ret->dir, "atm_final.tab", ctl, atm_i);
-    write_obs(ret->dir, "obs_final.tab", ctl, obs_i);
-    write_matrix(ret->dir, "matrix_kernel.tab", ctl, k_i,
-		 atm_i, obs_i, "y", "x", "r");
+    write_atm_async(ret->dir, "atm_final.tab", ctl, atm_i);
+    write_obs_async(ret->dir, "obs_final.tab", ctl, obs_i);
+    write_matrix_async(ret->dir, "matrix_kernel.tab", ctl, k_i, atm_i, obs_i,
+		       "y", "x", "r");
 
     /* Allocate... */
     gsl_matrix *auxnm = gsl_matrix_alloc(n, m);
-    gsl_matrix *corr = gsl_matrix_alloc(n, n);
-    gsl_matrix *gain = gsl_matrix_alloc(n, m);
 
     /* Compute inverse retrieval covariance...
        cov^{-1} = S_a^{-1} + K_i^T * S_eps^{-1} * K_i */
     matrix_product(k_i, sig_eps_inv, 1, cov);
-    gsl_matrix_add(cov, s_a_inv);
-
-    /* Compute retrieval covariance... */
-    matrix_invert(cov);
-    write_matrix(ret->dir, "matrix_cov_ret.tab", ctl, cov,
-		 atm_i, obs_i, "x", "x", "r");
-    write_stddev("total", ret, ctl, atm_i, cov);
+    for (size_t ib = 0; ib < nblk; ib++) {
+      const size_t nb = blk[ib + 1] - blk[ib];
+      gsl_matrix_view cov_blk =
+	gsl_matrix_submatrix(cov, blk[ib], blk[ib], nb, nb);
+      gsl_matrix_const_view s_a_blk =
+	gsl_matrix_const_submatrix(s_a_inv, blk[ib], blk[ib], nb, nb);
+      gsl_matrix_add(&cov_blk.matrix, &s_a_blk.matrix);
+    }
 
-    /* Compute correlation matrix... */
-    for (size_t i = 0; i < n; i++)
-      for (size_t j = 0; j < n; j++)
-	gsl_matrix_set(corr, i, j, gsl_matrix_get(cov, i, j)
-		       / sqrt(gsl_matrix_get(cov, i, i))
-		       / sqrt(gsl_matrix_get(cov, j, j)));
-    write_matrix(ret->dir, "matrix_corr.tab", ctl, corr,
-		 atm_i, obs_i, "x", "x", "r");
-
-    /* Compute gain matrix...
-       G = cov * K^T * S_eps^{-1} */
+    /* Set auxiliary matrix K^T * S_eps^{-1}... */
     for (size_t i = 0; i < n; i++)
       for (size_t j = 0; j < m; j++)
 	gsl_matrix_set(auxnm, i, j, gsl_matrix_get(k_i, j, i)
 		       * POW2(gsl_vector_get(sig_eps_inv, j)));
-    gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, cov, auxnm, 0.0, gain);
-    write_matrix(ret->dir, "matrix_gain.tab", ctl, gain,
-		 atm_i, obs_i, "x", "y", "c");
 
-    /* Compute retrieval error due to noise... */
-    matrix_product(gain, sig_noise, 2, a);
-    write_stddev("noise", ret, ctl, atm_i, a);
+    /* Full error analysis... */
+    if (ctl->write_matrix) {
+
+      /* Allocate... */
+      gsl_matrix *corr = gsl_matrix_alloc(n, n);
+      gsl_matrix *gain = gsl_matrix_alloc(n, m);
+      gsl_vector_const_view cov_diag = gsl_matrix_const_diagonal(cov);
+      gsl_vector_const_view a_diag = gsl_matrix_const_diagonal(a);
+
+      /* Compute retrieval covariance... */
+      matrix_invert(cov);
+      write_matrix_async(ret->dir, "matrix_cov_ret.tab", ctl, cov, atm_i,
+			 obs_i, "x", "x", "r");
+      write_stddev("total", ret, ctl, atm_i,
+		   &cov_diag.vector);
+
+      /* Compute correlation matrix... */
+      for (size_t i = 0; i < n; i++)
+	for (size_t j = 0; j < n; j++)
+	  gsl_matrix_set(corr, i, j, gsl_matrix_get(cov, i, j)
+			 / sqrt(gsl_matrix_get(cov, i, i))
+			 / sqrt(gsl_matrix_get(cov, j, j)));
+      write_matrix_async_own(ret->dir, "matrix_corr.tab", ctl, corr, atm_i,
+			     obs_i, "x", "x", "r");
+
+      /* Compute gain matrix...
+         G = cov * K^T * S_eps^{-1} */
+      gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, cov, auxnm, 0.0,
+		     gain);
+
+      /* Compute retrieval error due to noise... */
+      matrix_product(gain, sig_noise, 2, a);
+      write_stddev("noise", ret, ctl, atm_i,
+		   &a_diag.vector);
+
+      /* Compute retrieval error  due to forward model errors... */
+      matrix_product(gain, sig_formod, 2, a);
+      write_stddev("formod", ret, ctl, atm_i,
+		   &a_diag.vector);
+
+      /* Compute averaging kernel matrix
+         A = G * K ... */
+      gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, gain, k_i, 0.0, a);
+      write_matrix_async_own(ret->dir, "matrix_gain.tab", ctl, gain, atm_i,
+			     obs_i, "x", "y", "c");
+      write_matrix_async(ret->dir, "matrix_avk.tab", ctl, a, atm_i, obs_i, "x",
+			 "x", "r");
+
+      /* Analyze averaging kernel matrix... */
+      analyze_avk(ret, ctl, atm_i, iqa, ipa, a);
+    }
+
+    /* Diagonal error analysis (no matrix output requested)... */
+    else {
+
+      atm_t *atm_aux;
 
-    /* Compute retrieval error  due to forward model errors... */
-    matrix_product(gain, sig_formod, 2, a);
-    write_stddev("formod", ret, ctl, atm_i, a);
+      /* Allocate... */
+      ALLOC(atm_aux, atm_t, 1);
+      gsl_matrix *kq = gsl_matrix_calloc(m, NQ);
+      gsl_vector *x_aux = gsl_vector_alloc(n);
 
-    /* Compute averaging kernel matrix
-       A = G * K ... */
-    gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, gain, k_i, 0.0, a);
-    write_matrix(ret->dir, "matrix_avk.tab", ctl, a,
-		 atm_i, obs_i, "x", "x", "r");
+      /* Compute inverse Cholesky factor W = L^{-1} of cov^{-1}... */
+      matrix_inv_chol(cov);
+
+      /* Get retrieval variances from cov = W^T * W... */
+      for (size_t i = 0; i < n; i++) {
+	double var = 0;
+	for (size_t k = i; k < n; k++)
+	  var += POW2(gsl_matrix_get(cov, k, i));
+	gsl_vector_set(x_aux, i, var);
+      }
+      write_stddev("total", ret, ctl, atm_i, x_aux);
+
+      /* Compute gain matrix...
+         G = W^T * W * K^T * S_eps^{-1} */
+      gsl_blas_dtrmm(CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit,
+		     1.0, cov, auxnm);
+      gsl_blas_dtrmm(CblasLeft, CblasLower, CblasTrans, CblasNonUnit,
+		     1.0, cov, auxnm);
+      const gsl_matrix *gain = auxnm;
+
+      /* Compute retrieval error due to noise... */
+      for (size_t i = 0; i < n; i++) {
+	double var = 0;
+	for (size_t j = 0; j < m; j++)
+	  var += POW2(gsl_matrix_get(gain, i, j)
+		      * gsl_vector_get(sig_noise, j));
+	gsl_vector_set(x_aux, i, var);
+      }
+      write_stddev("noise", ret, ctl, atm_i, x_aux);
+
+      /* Compute retrieval error due to forward model errors... */
+      for (size_t i = 0; i < n; i++) {
+	double var = 0;
+	for (size_t j = 0; j < m; j++)
+	  var += POW2(gsl_matrix_get(gain, i, j)
+		      * gsl_vector_get(sig_formod, j));
+	gsl_vector_set(x_aux, i, var);
+      }
+      write_stddev("formod", ret, ctl, atm_i, x_aux);
 
-    /* Analyze averaging kernel matrix... */
-    analyze_avk(ret, ctl, atm_i, iqa, ipa, a);
+      /* Sum kernel columns of each quantity... */
+      for (size_t j = 0; j < m; j++)
+	for (size_t i = 0; i < n; i++)
+	  *gsl_matrix_ptr(kq, j, (size_t) iqa[i]) += gsl_matrix_get(k_i, j, i);
+
+      /* Get contribution (row sums of A = G * K within quantities)... */
+      for (size_t i = 0; i < n; i++) {
+	double cont = 0;
+	for (size_t j = 0; j < m; j++)
+	  cont += gsl_matrix_get(gain, i, j)
+	    * gsl_matrix_get(kq, j, (size_t) iqa[i]);
+	gsl_vector_set(x_aux, i, cont);
+      }
+      copy_atm(ctl, atm_aux, atm_i, 1);
+      x2atm(ctl, x_aux, atm_aux);
+      write_atm_async(ret->dir, "atm_cont.tab", ctl, atm_aux);
+
+      /* Get resolution (inverse diagonal of A = G * K)... */
+      for (size_t i = 0; i < n; i++) {
+	double avk = 0;
+	for (size_t j = 0; j < m; j++)
+	  avk += gsl_matrix_get(gain, i, j) * gsl_matrix_get(k_i, j, i);
+	gsl_vector_set(x_aux, i, 1 / avk);
+      }
+      copy_atm(ctl, atm_aux, atm_i, 1);
+      x2atm(ctl, x_aux, atm_aux);
+      write_atm_async(ret->dir, "atm_res.tab", ctl, atm_aux);
+
+      /* Free... */
+      gsl_matrix_free(kq);
+      gsl_vector_free(x_aux);
+      free_atm(atm_aux);
+      free(atm_aux);
+    }
 
     /* Free... */
     gsl_matrix_free(auxnm);
-    gsl_matrix_free(corr);
-    gsl_matrix_free(gain);
   }
 
   /* ------------------------------------------------------------
@@ -4866,6 +5881,231 @@ void optimal_estimation(
   gsl_vector_free(y_aux);
   gsl_vector_free(y_i);
   gsl_vector_free(y_m);
+
+  free(blk);
+  free(ipa);
+  free(iqa);
+
+  PROF_STOP(optimal_estimation);
+}
+
+/*****************************************************************************/
+
+void prof_init(
+  const char *basename) {
+
+  static int init = 0;
+
+  /* Set filename... */
+  sprintf(prof_file, "%s", basename);
+
+  /* Register output at exit... */
+  if (!init) {
+    init = 1;
+    atexit(prof_write);
+  }
+}
+
+/*****************************************************************************/
+
+int prof_register(
+  const char *name) {
+
+  int id = -1;
+
+#pragma omp critical (prof)
+  {
+    /* Find scope... */
+    for (int i = 0; i < prof_nscope; i++)
+      if (strcmp(prof_names[i], name) == 0)
+	id = i;
+
+    /* Add new scope... */
+    if (id < 0) {
+      if (prof_nscope >= PROFNS)
+	ERRMSG("Too many profiling scopes, increase PROFNS!");
+      sprintf(prof_names[prof_nscope], "%s", name);
+      id = prof_nscope++;
+    }
+  }
+
+  return id;
+}
+
+/*****************************************************************************/
+
+void prof_start(
+  const int id) {
+
+  /* Allocate accumulators of this thread... */
+  if (prof_local == NULL) {
+    ALLOC(prof_local, prof_thread_t, 1);
+    prof_local->nnode = 1;
+#pragma omp critical (prof)
+    {
+      prof_local->next = prof_threads;
+      prof_threads = prof_local;
+    }
+  }
+  prof_thread_t *pt = prof_local;
+
+  /* Get call-tree node... */
+  const int parent = (pt->depth > 0 ? pt->stack[pt->depth - 1] : 0);
+  int node = pt->node[parent].child[id];
+  if (node == 0) {
+    if (pt->nnode >= PROFNN)
+      ERRMSG("Too many profiling nodes, increase PROFNN!");
+    node = pt->nnode++;
+    pt->node[node].scope = id;
+    pt->node[node].parent = parent;
+    pt->node[node].min = 1e99;
+    pt->node[parent].child[id] = node;
+  }
+
+  /* Push scope... */
+  if (pt->depth >= PROFND)
+    ERRMSG("Profiling scopes nested too deeply, increase PROFND!");
+  pt->stack[pt->depth] = node;
+  pt->t0[pt->depth] = omp_get_wtime();
+  pt->depth++;
+}
+
+/*****************************************************************************/
+
+void prof_stop(
+  const int id) {
+
+  const double t1 = omp_get_wtime();
+
+  /* Check scope... */
+  prof_thread_t *pt = prof_local;
+  if (pt == NULL || pt->depth <= 0
+      || pt->node[pt->stack[pt->depth - 1]].scope != id)
+    ERRMSG("Profiling scope %s is not open!", prof_names[id]);
+
+  /* Pop scope and update accumulators... */
+  pt->depth--;
+  prof_node_t *nd = &pt->node[pt->stack[pt->depth]];
+  const double dt = t1 - pt->t0[pt->depth];
+  nd->count++;
+  nd->sum += dt;
+  nd->min = MIN(nd->min, dt);
+  nd->max = MAX(nd->max, dt);
+}
+
+/*****************************************************************************/
+
+void prof_write(
+  void) {
+
+  FILE *out;
+
+  char filename[2 * LEN], **path;
+
+  int n = 0, nmax = 0, *depth, *name, *nthread;
+
+  long *count;
+
+  double *sum, *min, *max;
+
+  /* Allocate... */
+  for (prof_thread_t * pt = prof_threads; pt != NULL; pt = pt->next)
+    nmax += pt->nnode;
+  nmax = MAX(nmax, 1);
+  ALLOC(path, char *,
+	nmax);
+  ALLOC(depth, int,
+	nmax);
+  ALLOC(name, int,
+	nmax);
+  ALLOC(nthread, int,
+	nmax);
+  ALLOC(count, long,
+	nmax);
+  ALLOC(sum, double,
+	nmax);
+  ALLOC(min, double,
+	nmax);
+  ALLOC(max, double,
+	nmax);
+
+  /* Merge call trees of all threads by path... */
+  for (prof_thread_t * pt = prof_threads; pt != NULL; pt = pt->next)
+    for (int inode = 1; inode < pt->nnode; inode++) {
+
+      /* Get path... */
+      char p[LEN] = "", aux[LEN];
+      int d = 0;
+      for (int i = inode; i > 0; i = pt->node[i].parent, d++) {
+	sprintf(aux, "%s%s%s", prof_names[pt->node[i].scope],
+		(p[0] != '\0' ? "/" : ""), p);
+	sprintf(p, "%s", aux);
+      }
+
+      /* Find or add entry... */
+      int k = 0;
+      while (k < n && strcmp(path[k], p) != 0)
+	k++;
+      if (k == n) {
+	path[k] = strdup(p);
+	depth[k] = d;
+	name[k] = pt->node[inode].scope;
+	min[k] = 1e99;
+	n++;
+      }
+
+      /* Merge accumulators... */
+      nthread[k]++;
+      count[k] += pt->node[inode].count;
+      sum[k] += pt->node[inode].sum;
+      min[k] = MIN(min[k], pt->node[inode].min);
+      max[k] = MAX(max[k], pt->node[inode].max);
+    }
+
+  /* Write JSON file... */
+  sprintf(filename, "%s.json", prof_file);
+  LOG(1, "Write profiling timers: %s", filename);
+  if (!(out = fopen(filename, "w"))) {
+    WARN("Cannot create file!");
+    return;
+  }
+  fprintf(out, "{\n  \"scopes\": [");
+  for (int k = 0; k < n; k++)
+    fprintf(out, "%s\n    {\"path\": \"%s\", \"name\": \"%s\", \"depth\": %d,"
+	    " \"threads\": %d, \"calls\": %ld, \"total\": %.9g,"
+	    " \"min\": %.9g, \"mean\": %.9g, \"max\": %.9g}",
+	    (k > 0 ? "," : ""), path[k], prof_names[name[k]], depth[k],
+	    nthread[k], count[k], sum[k], count[k] > 0 ? min[k] : 0,
+	    count[k] > 0 ? sum[k] / (double) count[k] : 0, max[k]);
+  fprintf(out, "\n  ]\n}\n");
+  fclose(out);
+
+  /* Write CSV file... */
+  sprintf(filename, "%s.csv", prof_file);
+  LOG(1, "Write profiling timers: %s", filename);
+  if (!(out = fopen(filename, "w"))) {
+    WARN("Cannot create file!");
+    return;
+  }
+  fprintf(out, "path,name,depth,threads,calls,total_s,min_s,mean_s,max_s\n");
+  for (int k = 0; k < n; k++)
+    fprintf(out, "%s,%s,%d,%d,%ld,%.9g,%.9g,%.9g,%.9g\n",
+	    path[k], prof_names[name[k]], depth[k], nthread[k], count[k],
+	    sum[k], count[k] > 0 ? min[k] : 0,
+	    count[k] > 0 ? sum[k] / (double) count[k] : 0, max[k]);
+  fclose(out);
+
+  /* Free... */
+  for (int k = 0; k < n; k++)
+    free(path[k]);
+  free(path);
+  free(depth);
+  free(name);
+  free(nthread);
+  free(count);
+  free(sum);
+  free(min);
+  free(max);
 }
 
 /*****************************************************************************/
@@ -4906,6 +6146,8 @@ void raytrace(
   if (obs->vpz[ir] > zmax)
     return;
 
+  PROF_START(raytrace);
+
   /* Determine Cartesian coordinates for observer and view point... */
   geo2cart(obs->obsz[ir], obs->obslon[ir], obs->obslat[ir], xobs);
   geo2cart(obs->vpz[ir], obs->vplon[ir], obs->vplat[ir], xvp);
@@ -4974,6 +6216,9 @@ void raytrace(
     /* Interpolate atmospheric data... */
     intpol_atm(ctl, atm, z, &p, &t, q, k);
 
+    /* Allocate... */
+    alloc_los(ctl, los, los->np + 1);
+
     /* Save data... */
     los->lon[los->np] = lon;
     los->lat[los->np] = lat;
@@ -4997,9 +6242,8 @@ void raytrace(
       }
     }
 
-    /* Increment and check number of LOS points... */
-    if ((++los->np) > NLOS)
-      ERRMSG("Too many LOS points!");
+    /* Increment number of LOS points... */
+    los->np++;
 
     /* Check stop flag... */
     if (stop) {
@@ -5102,6 +6346,8 @@ void raytrace(
 	los->cgp[ip][ig] /= los->cgu[ip][ig];
 	los->cgt[ip][ig] /= los->cgu[ip][ig];
       }
+
+  PROF_STOP(raytrace);
 }
 
 /*****************************************************************************/
@@ -5116,6 +6362,8 @@ void read_atm(
 
   char file[LEN];
 
+  PROF_START(read_atm);
+
   /* Init... */
   atm->np = 0;
 
@@ -5140,6 +6388,10 @@ void read_atm(
   else if (ctl->atmfmt == 2)
     read_atm_bin(in, ctl, atm);
 
+  /* Map binary data... */
+  else if (ctl->atmfmt == 3)
+    read_atm_map(in, ctl, 0, atm);
+
   /* Error... */
   else
     ERRMSG("Unknown atmospheric data file format, check ATMFMT!");
@@ -5185,6 +6437,8 @@ void read_atm(
 	atm->sft, atm->sfeps[0], atm->sfeps[ctl->nsf - 1]);
   } else
     LOG(2, "Surface layer: none");
+
+  PROF_STOP(read_atm);
 }
 
 /*****************************************************************************/
@@ -5196,38 +6450,44 @@ void read_atm_asc(
 
   char line[LEN], *tok;
 
+  int nline = 0;
+
   /* Init... */
   atm->np = 0;
 
   /* Read line... */
   while (fgets(line, LEN, in)) {
+    nline++;
+
+    /* Allocate... */
+    alloc_atm(ctl, atm, atm->np + 1);
 
     /* Read data... */
-    TOK(line, tok, "%lg", atm->time[atm->np]);
-    TOK(NULL, tok, "%lg", atm->z[atm->np]);
-    TOK(NULL, tok, "%lg", atm->lon[atm->np]);
-    TOK(NULL, tok, "%lg", atm->lat[atm->np]);
-    TOK(NULL, tok, "%lg", atm->p[atm->np]);
-    TOK(NULL, tok, "%lg", atm->t[atm->np]);
+    tok = line;
+    FTOK(tok, nline, atm->time[atm->np]);
+    FTOK(tok, nline, atm->z[atm->np]);
+    FTOK(tok, nline, atm->lon[atm->np]);
+    FTOK(tok, nline, atm->lat[atm->np]);
+    FTOK(tok, nline, atm->p[atm->np]);
+    FTOK(tok, nline, atm->t[atm->np]);
     for (int ig = 0; ig < ctl->ng; ig++)
-      TOK(NULL, tok, "%lg", atm->q[ig][atm->np]);
+      FTOK(tok, nline, atm->q[ig][atm->np]);
     for (int iw = 0; iw < ctl->nw; iw++)
-      TOK(NULL, tok, "%lg", atm->k[iw][atm->np]);
+      FTOK(tok, nline, atm->k[iw][atm->np]);
     if (ctl->ncl > 0 && atm->np == 0) {
-      TOK(NULL, tok, "%lg", atm->clz);
-      TOK(NULL, tok, "%lg", atm->cldz);
+      FTOK(tok, nline, atm->clz);
+      FTOK(tok, nline, atm->cldz);
       for (int icl = 0; icl < ctl->ncl; icl++)
-	TOK(NULL, tok, "%lg", atm->clk[icl]);
+	FTOK(tok, nline, atm->clk[icl]);
     }
     if (ctl->nsf > 0 && atm->np == 0) {
-      TOK(NULL, tok, "%lg", atm->sft);
+      FTOK(tok, nline, atm->sft);
       for (int isf = 0; isf < ctl->nsf; isf++)
-	TOK(NULL, tok, "%lg", atm->sfeps[isf]);
+	FTOK(tok, nline, atm->sfeps[isf]);
     }
 
     /* Increment data point counter... */
-    if ((++atm->np) > NP)
-      ERRMSG("Too many data points!");
+    atm->np++;
   }
 }
 
@@ -5268,8 +6528,7 @@ void read_atm_bin(
 	1,
 	in);
   atm->np = (int) np;
-  if (atm->np > NP)
-    ERRMSG("Too many data points!");
+  alloc_atm(ctl, atm, atm->np);
   FREAD(atm->time, double,
 	np,
 	in);
@@ -5319,6 +6578,58 @@ void read_atm_bin(
 
 /*****************************************************************************/
 
+void read_atm_map(
+  FILE *in,
+  const ctl_t *ctl,
+  const size_t rec,
+  atm_t *atm) {
+
+  size_t len, np;
+
+  void *map;
+
+  /* Map record... */
+  const int dim[4] = { ctl->ng, ctl->nw, ctl->ncl, ctl->nsf };
+  double *d = read_map_rec(in, "ATM2", dim, 4, rec, &np, &map, &len);
+  if (len != ((6 + (size_t) (ctl->ng + ctl->nw)) * np
+	      + 3 + (size_t) (ctl->ncl + ctl->nsf)) * sizeof(double))
+    ERRMSG("Error reading record size!");
+
+  /* Set views on mapped data... */
+  free_atm(atm);
+  atm->map = map;
+  atm->map_len = len;
+  atm->np = atm->np_alloc = (int) np;
+  atm->ng_alloc = ctl->ng;
+  atm->nw_alloc = ctl->nw;
+  atm->time = d;
+  atm->z = d + np;
+  atm->lon = d + 2 * np;
+  atm->lat = d + 3 * np;
+  atm->p = d + 4 * np;
+  atm->t = d + 5 * np;
+  ALLOC(atm->q, double *,
+	MAX(ctl->ng, 1));
+  for (int ig = 0; ig < ctl->ng; ig++)
+    atm->q[ig] = d + (6 + (size_t) ig) * np;
+  ALLOC(atm->k, double *,
+	MAX(ctl->nw, 1));
+  for (int iw = 0; iw < ctl->nw; iw++)
+    atm->k[iw] = d + (6 + (size_t) (ctl->ng + iw)) * np;
+
+  /* Copy cloud and surface parameters... */
+  const double *c = d + (6 + (size_t) (ctl->ng + ctl->nw)) * np;
+  atm->clz = c[0];
+  atm->cldz = c[1];
+  for (int icl = 0; icl < ctl->ncl; icl++)
+    atm->clk[icl] = c[2 + icl];
+  atm->sft = c[2 + ctl->ncl];
+  for (int isf = 0; isf < ctl->nsf; isf++)
+    atm->sfeps[isf] = c[3 + ctl->ncl + isf];
+}
+
+/*****************************************************************************/
+
 void read_ctl(
   int argc,
   char *argv[],
@@ -5383,6 +6694,7 @@ void read_ctl(
   /* File formats... */
   ctl->atmfmt = (int) scan_ctl(argc, argv, "ATMFMT", -1, "1", NULL);
   ctl->obsfmt = (int) scan_ctl(argc, argv, "OBSFMT", -1, "1", NULL);
+  ctl->matrixfmt = (int) scan_ctl(argc, argv, "MATRIXFMT", -1, "1", NULL);
 
   /* Hydrostatic equilibrium... */
   ctl->hydz = scan_ctl(argc, argv, "HYDZ", -1, "-999", NULL);
@@ -5426,6 +6738,18 @@ void read_ctl(
   ctl->write_bbt = (int) scan_ctl(argc, argv, "WRITE_BBT", -1, "0", NULL);
   ctl->write_matrix =
     (int) scan_ctl(argc, argv, "WRITE_MATRIX", -1, "0", NULL);
+  ctl->write_async =
+    (int) scan_ctl(argc, argv, "WRITE_ASYNC", -1, "0", NULL);
+
+  /* Profiling timers... */
+  scan_ctl(argc, argv, "PROFILE", -1, "-", ctl->profile);
+#ifdef TIMERS
+  if (ctl->profile[0] != '-')
+    prof_init(ctl->profile);
+#else
+  if (ctl->profile[0] != '-')
+    WARN("Profiling timers are disabled, compile with TIMERS=1!");
+#endif
 
   /* External forward models... */
   ctl->formod = (int) scan_ctl(argc, argv, "FORMOD", -1, "1", NULL);
@@ -5437,18 +6761,148 @@ void read_ctl(
 
 /*****************************************************************************/
 
+void read_ctlmap(
+  int argc,
+  char *argv[],
+  ctlmap_t *map) {
+
+  FILE *in = NULL;
+
+  char dummy[LEN], line[LEN], rvarname[LEN], rval[LEN];
+
+  size_t n = (size_t) argc;
+
+  /* Free old map... */
+  if (map->name != NULL) {
+    for (size_t i = 0; i < map->size; i++)
+      if (map->name[i] != NULL) {
+	free(map->name[i]);
+	free(map->val[i]);
+      }
+    free(map->name);
+    free(map->val);
+    free(map->src);
+    free(map->pos);
+  }
+
+  /* Open file and count lines... */
+  if (argv[1][0] != '-') {
+    if (!(in = fopen(argv[1], "r")))
+      ERRMSG("Cannot open file!");
+    while (fgets(line, LEN, in))
+      n++;
+    rewind(in);
+  }
+
+  /* Allocate... */
+  map->argc = argc;
+  map->argv = argv;
+  for (map->size = 16; map->size < 2 * n; map->size *= 2);
+  ALLOC(map->name, char *,
+	map->size);
+  ALLOC(map->val, char *,
+	map->size);
+  ALLOC(map->src, int,
+	map->size);
+  ALLOC(map->pos, int,
+	map->size);
+
+  /* Read control file... */
+  if (in != NULL) {
+    for (int iline = 0; fgets(line, LEN, in); iline++)
+      if (sscanf(line, "%s %s %s", rvarname, dummy, rval) == 3) {
+	const size_t i = locate_ctlmap(map, 0, rvarname);
+	if (map->name[i] == NULL) {
+	  map->name[i] = strdup(rvarname);
+	  map->val[i] = strdup(rval);
+	  map->src[i] = 0;
+	  map->pos[i] = iline;
+	}
+      }
+    fclose(in);
+  }
+
+  /* Read command line... */
+  for (int iarg = 1; iarg < argc - 1; iarg++) {
+    const size_t i = locate_ctlmap(map, 1, argv[iarg]);
+    if (map->name[i] == NULL) {
+      map->name[i] = strdup(argv[iarg]);
+      map->val[i] = strdup(argv[iarg + 1]);
+      map->src[i] = 1;
+      map->pos[i] = iarg;
+    }
+  }
+}
+
+/*****************************************************************************/
+
+double *read_map_rec(
+  FILE *in,
+  const char *magic,
+  const int *dim,
+  const int ndim,
+  const size_t rec,
+  size_t *n,
+  void **map,
+  size_t *len) {
+
+  /* Read header... */
+  char magic2[4];
+  FREAD(magic2, char,
+	4,
+	in);
+  if (memcmp(magic2, magic, 4) != 0)
+    ERRMSG("Invalid magic string!");
+  for (int i = 0; i < ndim; i++) {
+    int dim2;
+    FREAD(&dim2, int,
+	  1,
+	  in);
+    if (dim2 != dim[i])
+      ERRMSG("Error reading file header!");
+  }
+
+  /* Read index entry... */
+  size_t nrec, idx[3];
+  FREAD(&nrec, size_t,
+	1,
+	in);
+  if (rec >= nrec)
+    ERRMSG("Record %zu not found (file has %zu records)!", rec, nrec);
+  if (fseek(in, (long) (rec * sizeof(idx)), SEEK_CUR) != 0)
+    ERRMSG("Seek error in read_map_rec!");
+  FREAD(idx, size_t,
+	3,
+	in);
+  *n = idx[1];
+  *len = idx[2];
+  if (*len == 0)
+    ERRMSG("Empty record!");
+
+  /* Map record (start at page boundary)... */
+  const size_t page = (size_t) sysconf(_SC_PAGESIZE);
+  const size_t off = idx[0] / page * page, delta = idx[0] - off;
+  void *base = mmap(NULL, *len + delta, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+		    fileno(in), (off_t) off);
+  if (base == MAP_FAILED)
+    ERRMSG("Cannot map file: %s", strerror(errno));
+  *map = base;
+  *len += delta;
+
+  return (double *) ((char *) base + delta);
+}
+
+/*****************************************************************************/
+
 void read_matrix(
   const char *dirname,
   const char *filename,
+  const ctl_t *ctl,
   gsl_matrix *matrix) {
 
   FILE *in;
 
-  char dum[LEN], file[LEN], line[LEN];
-
-  double value;
-
-  int i, j;
+  char file[LEN];
 
   /* Set filename... */
   if (dirname != NULL)
@@ -5463,6 +6917,34 @@ void read_matrix(
   if (!(in = fopen(file, "r")))
     ERRMSG("Cannot open file!");
 
+  /* Read ASCII data... */
+  if (ctl->matrixfmt == 1)
+    read_matrix_asc(in, matrix);
+
+  /* Read binary data... */
+  else if (ctl->matrixfmt == 2)
+    read_matrix_bin(in, matrix);
+
+  /* Error... */
+  else
+    ERRMSG("Unknown matrix file format, check MATRIXFMT!");
+
+  /* Close file... */
+  fclose(in);
+}
+
+/*****************************************************************************/
+
+void read_matrix_asc(
+  FILE *in,
+  gsl_matrix *matrix) {
+
+  char dum[LEN], line[LEN];
+
+  double value;
+
+  int i, j;
+
   /* Read data... */
   gsl_matrix_set_zero(matrix);
   while (fgets(line, LEN, in))
@@ -5470,9 +6952,42 @@ void read_matrix(
 	       &i, dum, dum, dum, dum, dum,
 	       &j, dum, dum, dum, dum, dum, &value) == 13)
       gsl_matrix_set(matrix, (size_t) i, (size_t) j, value);
+}
 
-  /* Close file... */
-  fclose(in);
+/*****************************************************************************/
+
+void read_matrix_bin(
+  FILE *in,
+  gsl_matrix *matrix) {
+
+  /* Read header... */
+  char magic[4], space[2];
+  FREAD(magic, char,
+	4,
+	in);
+  if (memcmp(magic, "MAT1", 4) != 0)
+    ERRMSG("Invalid magic string!");
+  FREAD(space, char,
+	2,
+	in);
+
+  size_t n[2];
+  FREAD(n, size_t,
+	2,
+	in);
+  if (n[0] != matrix->size1 || n[1] != matrix->size2)
+    ERRMSG("Error reading file header!");
+
+  /* Skip descriptor tables... */
+  if (fseek(in, (long) ((n[0] + n[1]) * (sizeof(int) + 4 * sizeof(double))),
+	    SEEK_CUR) != 0)
+    ERRMSG("Error while reading!");
+
+  /* Read matrix data... */
+  for (size_t i = 0; i < n[0]; i++)
+    FREAD(gsl_matrix_ptr(matrix, i, 0), double,
+	  n[1],
+	  in);
 }
 
 /*****************************************************************************/
@@ -5487,6 +7002,8 @@ void read_obs(
 
   char file[LEN];
 
+  PROF_START(read_obs);
+
   /* Set filename... */
   if (dirname != NULL)
     sprintf(file, "%s/%s", dirname, filename);
@@ -5508,6 +7025,10 @@ void read_obs(
   else if (ctl->obsfmt == 2)
     read_obs_bin(in, ctl, obs);
 
+  /* Map binary data... */
+  else if (ctl->obsfmt == 3)
+    read_obs_map(in, ctl, 0, obs);
+
   /* Error... */
   else
     ERRMSG("Unknown observation file format!");
@@ -5559,6 +7080,8 @@ void read_obs(
 	  ctl->nu[id], mini, maxi);
     }
   }
+
+  PROF_STOP(read_obs);
 }
 
 /*****************************************************************************/
@@ -5568,6 +7091,20 @@ void read_obs_asc(
   const ctl_t *ctl,
   obs_t *obs) {
 
+  /* Read all ray paths... */
+  int nline = 0;
+  read_obs_asc_chunk(in, ctl, obs, INT_MAX, &nline);
+}
+
+/*****************************************************************************/
+
+int read_obs_asc_chunk(
+  FILE *in,
+  const ctl_t *ctl,
+  obs_t *obs,
+  const int nmax,
+  int *nline) {
+
   char line[LEN], *tok;
 
   /* Init... */
@@ -5575,27 +7112,43 @@ void read_obs_asc(
 
   /* Read line... */
   while (fgets(line, LEN, in)) {
+    (*nline)++;
+
+    /* Allocate... */
+    alloc_obs(ctl, obs, obs->nr + 1);
 
     /* Read data... */
-    TOK(line, tok, "%lg", obs->time[obs->nr]);
-    TOK(NULL, tok, "%lg", obs->obsz[obs->nr]);
-    TOK(NULL, tok, "%lg", obs->obslon[obs->nr]);
-    TOK(NULL, tok, "%lg", obs->obslat[obs->nr]);
-    TOK(NULL, tok, "%lg", obs->vpz[obs->nr]);
-    TOK(NULL, tok, "%lg", obs->vplon[obs->nr]);
-    TOK(NULL, tok, "%lg", obs->vplat[obs->nr]);
-    TOK(NULL, tok, "%lg", obs->tpz[obs->nr]);
-    TOK(NULL, tok, "%lg", obs->tplon[obs->nr]);
-    TOK(NULL, tok, "%lg", obs->tplat[obs->nr]);
+    tok = line;
+    FTOK(tok, *nline, obs->time[obs->nr]);
+
+    /* Check chunk size (keep rays of a field-of-view scan together)... */
+    if (obs->nr >= nmax && (ctl->fov[0] == '-'
+			    || obs->time[obs->nr] != obs->time[obs->nr - 1])) {
+      if (fseek(in, -(long) strlen(line), SEEK_CUR) != 0)
+	ERRMSG("Cannot push back line (input stream not seekable?)!");
+      (*nline)--;
+      break;
+    }
+
+    FTOK(tok, *nline, obs->obsz[obs->nr]);
+    FTOK(tok, *nline, obs->obslon[obs->nr]);
+    FTOK(tok, *nline, obs->obslat[obs->nr]);
+    FTOK(tok, *nline, obs->vpz[obs->nr]);
+    FTOK(tok, *nline, obs->vplon[obs->nr]);
+    FTOK(tok, *nline, obs->vplat[obs->nr]);
+    FTOK(tok, *nline, obs->tpz[obs->nr]);
+    FTOK(tok, *nline, obs->tplon[obs->nr]);
+    FTOK(tok, *nline, obs->tplat[obs->nr]);
     for (int id = 0; id < ctl->nd; id++)
-      TOK(NULL, tok, "%lg", obs->rad[id][obs->nr]);
+      FTOK(tok, *nline, obs->rad[id][obs->nr]);
     for (int id = 0; id < ctl->nd; id++)
-      TOK(NULL, tok, "%lg", obs->tau[id][obs->nr]);
+      FTOK(tok, *nline, obs->tau[id][obs->nr]);
 
     /* Increment counter... */
-    if ((++obs->nr) > NR)
-      ERRMSG("Too many rays!");
+    obs->nr++;
   }
+
+  return obs->nr;
 }
 
 /*****************************************************************************/
@@ -5626,8 +7179,7 @@ void read_obs_bin(
 	1,
 	in);
   obs->nr = (int) nr;
-  if (obs->nr > NR)
-    ERRMSG("Too many ray paths!");
+  alloc_obs(ctl, obs, obs->nr);
   FREAD(obs->time, double,
 	nr,
 	in);
@@ -5670,6 +7222,49 @@ void read_obs_bin(
 
 /*****************************************************************************/
 
+void read_obs_map(
+  FILE *in,
+  const ctl_t *ctl,
+  const size_t rec,
+  obs_t *obs) {
+
+  size_t len, nr;
+
+  void *map;
+
+  /* Map record... */
+  double *d = read_map_rec(in, "OBS2", &ctl->nd, 1, rec, &nr, &map, &len);
+  if (len != (10 + 2 * (size_t) ctl->nd) * nr * sizeof(double))
+    ERRMSG("Error reading record size!");
+
+  /* Set views on mapped data... */
+  free_obs(obs);
+  obs->map = map;
+  obs->map_len = len;
+  obs->nr = obs->nr_alloc = (int) nr;
+  obs->nd_alloc = ctl->nd;
+  obs->time = d;
+  obs->obsz = d + nr;
+  obs->obslon = d + 2 * nr;
+  obs->obslat = d + 3 * nr;
+  obs->vpz = d + 4 * nr;
+  obs->vplon = d + 5 * nr;
+  obs->vplat = d + 6 * nr;
+  obs->tpz = d + 7 * nr;
+  obs->tplon = d + 8 * nr;
+  obs->tplat = d + 9 * nr;
+  ALLOC(obs->rad, double *,
+	MAX(ctl->nd, 1));
+  ALLOC(obs->tau, double *,
+	MAX(ctl->nd, 1));
+  for (int id = 0; id < ctl->nd; id++) {
+    obs->rad[id] = d + (10 + (size_t) id) * nr;
+    obs->tau[id] = d + (10 + (size_t) (ctl->nd + id)) * nr;
+  }
+}
+
+/*****************************************************************************/
+
 double read_obs_rfm(
   const char *basename,
   const double z,
@@ -5728,8 +7323,94 @@ double read_obs_rfm(
 
 /*****************************************************************************/
 
-void read_ret(
-  int argc,
+int read_prf_close(
+  prf_t *prf) {
+
+  if (!prf || !prf->fp)
+    return -1;
+
+  /* Check mode... */
+  if (prf->dirty)
+    ERRMSG("Use write_prf_close() for output containers!");
+
+  /* Close file... */
+  fclose(prf->fp);
+  free(prf->offset);
+  memset(prf, 0, sizeof(*prf));
+
+  return 0;
+}
+
+/*****************************************************************************/
+
+void read_prf_open(
+  const char *filename,
+  const ctl_t *ctl,
+  prf_t *prf) {
+
+  /* Write info... */
+  LOG(1, "Read profile container: %s", filename);
+
+  /* Open file... */
+  memset(prf, 0, sizeof(*prf));
+  if (!(prf->fp = fopen(filename, "r")))
+    ERRMSG("Cannot open file!");
+
+  /* Read header... */
+  char magic[4];
+  FREAD(magic, char,
+	4,
+	prf->fp);
+  if (memcmp(magic, "PRF1", 4) != 0)
+    ERRMSG("Invalid magic string!");
+
+  int dim[5];
+  FREAD(dim, int,
+	5,
+	prf->fp);
+  if (dim[0] != ctl->ng || dim[1] != ctl->nw || dim[2] != ctl->ncl
+      || dim[3] != ctl->nsf || dim[4] != ctl->nd)
+    ERRMSG("Error reading file header!");
+
+  FREAD(&prf->n, size_t,
+	1,
+	prf->fp);
+
+  /* Read index... */
+  ALLOC(prf->offset, int64_t, prf->n);
+  FREAD(prf->offset, int64_t, prf->n, prf->fp);
+
+  /* Write info... */
+  LOG(2, "Number of records: %zu", prf->n);
+}
+
+/*****************************************************************************/
+
+void read_prf_single(
+  prf_t *prf,
+  const ctl_t *ctl,
+  const size_t rec,
+  atm_t *atm,
+  obs_t *obs) {
+
+  /* Check record index... */
+  if (rec >= prf->n)
+    ERRMSG("Record %zu not found in profile container!", rec);
+
+  /* Read record (the file position is shared between threads)... */
+#pragma omp critical (prf_io)
+  {
+    if (fseek(prf->fp, (long) prf->offset[rec], SEEK_SET) != 0)
+      ERRMSG("Seek error in read_prf_single!");
+    read_atm_bin(prf->fp, ctl, atm);
+    read_obs_bin(prf->fp, ctl, obs);
+  }
+}
+
+/*****************************************************************************/
+
+void read_ret(
+  int argc,
   char *argv[],
   const ctl_t *ctl,
   ret_t *ret) {
@@ -5737,6 +7418,8 @@ void read_ret(
   /* Iteration control... */
   ret->kernel_recomp =
     (int) scan_ctl(argc, argv, "KERNEL_RECOMP", -1, "3", NULL);
+  ret->kernel_broyden =
+    (int) scan_ctl(argc, argv, "KERNEL_BROYDEN", -1, "0", NULL);
   ret->conv_itmax = (int) scan_ctl(argc, argv, "CONV_ITMAX", -1, "30", NULL);
   ret->conv_dmin = scan_ctl(argc, argv, "CONV_DMIN", -1, "0.1", NULL);
 
@@ -5777,6 +7460,13 @@ void read_ret(
   ret->err_sft = scan_ctl(argc, argv, "ERR_SFT", -1, "0", NULL);
   for (int isf = 0; isf < ctl->nsf; isf++)
     ret->err_sfeps[isf] = scan_ctl(argc, argv, "ERR_SFEPS", isf, "0", NULL);
+
+  ret->err_rho_min = scan_ctl(argc, argv, "ERR_RHO_MIN", -1, "0", NULL);
+
+  /* Warm start... */
+  ret->warm_start = (int) scan_ctl(argc, argv, "WARM_START", -1, "0", NULL);
+  ret->warm_dh = scan_ctl(argc, argv, "WARM_DH", -1, "500", NULL);
+  ret->warm_dz = scan_ctl(argc, argv, "WARM_DZ", -1, "1", NULL);
 }
 
 /*****************************************************************************/
@@ -5887,6 +7577,8 @@ void read_shape(
 tbl_t *read_tbl(
   const ctl_t *ctl) {
 
+  PROF_START(read_tbl);
+
   /* Allocate... */
   tbl_t *tbl;
   ALLOC(tbl, tbl_t, 1);
@@ -5930,6 +7622,8 @@ tbl_t *read_tbl(
   /* Initialize source function... */
   init_srcfunc(ctl, tbl);
 
+  PROF_STOP(read_tbl);
+
   /* Return pointer... */
   return tbl;
 }
@@ -5967,7 +7661,18 @@ void read_tbl_asc(
   while (fgets(line, LEN, in)) {
 
     /* Parse line... */
-    if (sscanf(line, "%lg %lg %lg %lg", &press, &temp, &u, &eps) != 4)
+    char *p0 = line, *p1;
+    press = strtod(p0, &p1);
+    if (p1 == p0)
+      continue;
+    temp = strtod(p0 = p1, &p1);
+    if (p1 == p0)
+      continue;
+    u = strtod(p0 = p1, &p1);
+    if (p1 == p0)
+      continue;
+    eps = strtod(p0 = p1, &p1);
+    if (p1 == p0)
       continue;
 
     /* Check ranges... */
@@ -6272,18 +7977,12 @@ double scan_ctl(
   const char *defvalue,
   char *value) {
 
-  FILE *in = NULL;
+  static ctlmap_t map;
 
-  char dummy[LEN], fullname1[LEN], fullname2[LEN], line[LEN],
-    rvarname[LEN], rval[LEN];
+  char fullname1[LEN], fullname2[LEN], rval[LEN];
 
   int contain = 0;
 
-  /* Open file... */
-  if (argv[1][0] != '-')
-    if (!(in = fopen(argv[1], "r")))
-      ERRMSG("Cannot open file!");
-
   /* Set full variable name... */
   if (arridx >= 0) {
     sprintf(fullname1, "%s[%d]", varname, arridx);
@@ -6293,26 +7992,25 @@ double scan_ctl(
     sprintf(fullname2, "%s", varname);
   }
 
-  /* Read data... */
-  if (in != NULL)
-    while (fgets(line, LEN, in))
-      if (sscanf(line, "%s %s %s", rvarname, dummy, rval) == 3)
-	if (strcasecmp(rvarname, fullname1) == 0 ||
-	    strcasecmp(rvarname, fullname2) == 0) {
-	  contain = 1;
-	  break;
-	}
-  for (int i = 1; i < argc - 1; i++)
-    if (strcasecmp(argv[i], fullname1) == 0 ||
-	strcasecmp(argv[i], fullname2) == 0) {
-      sprintf(rval, "%s", argv[i + 1]);
-      contain = 1;
-      break;
+#pragma omp critical (scan_ctl)
+  {
+    /* Parse control file and command line only once... */
+    if (map.argc != argc || map.argv != argv)
+      read_ctlmap(argc, argv, &map);
+
+    /* Get first match in control file, then on command line... */
+    for (int src = 0; src <= 1; src++) {
+      size_t i = locate_ctlmap(&map, src, fullname1);
+      const size_t i2 = locate_ctlmap(&map, src, fullname2);
+      if (map.name[i] == NULL
+	  || (map.name[i2] != NULL && map.pos[i2] < map.pos[i]))
+	i = i2;
+      if (map.name[i] != NULL) {
+	sprintf(rval, "%s", map.val[i]);
+	contain = 1;
+      }
     }
-
-  /* Close file... */
-  if (in != NULL)
-    fclose(in);
+  }
 
   /* Check for missing variables... */
   if (!contain) {
@@ -6333,6 +8031,38 @@ double scan_ctl(
 
 /*****************************************************************************/
 
+int scan_tok(
+  char **s,
+  double *x) {
+
+  /* Skip separators... */
+  char *p = *s;
+  while (*p == ' ' || *p == '\t')
+    p++;
+
+  /* Check for end of line... */
+  if (*p == '\0') {
+    *s = p;
+    return -1;
+  }
+
+  /* Find end of token... */
+  char *q = p;
+  while (*q != '\0' && *q != ' ' && *q != '\t')
+    q++;
+
+  /* Convert token... */
+  char *end;
+  *x = strtod(p, &end);
+
+  /* Move to next token... */
+  *s = q;
+
+  return (end != p);
+}
+
+/*****************************************************************************/
+
 void set_cov_apr(
   const ret_t *ret,
   const ctl_t *ctl,
@@ -6384,61 +8114,111 @@ void set_cov_apr(
   for (size_t i = 0; i < n; i++)
     gsl_matrix_set(s_a, i, i, POW2(gsl_vector_get(x_a, i)));
 
-  /* Loop over matrix elements... */
-  for (size_t i = 0; i < n; i++)
-    for (size_t j = 0; j < n; j++)
-      if (i != j && iqa[i] == iqa[j]) {
+  /* Allocate... */
+  double *ch, *cz, *xc;
+  ALLOC(ch, double,
+	n);
+  ALLOC(cz, double,
+	n);
+  ALLOC(xc, double,
+	3 * n);
+
+  /* Get correlation lengths and Cartesian coordinates... */
+  for (size_t i = 0; i < n; i++) {
 
-	/* Initialize... */
-	double cz = 0;
-	double ch = 0;
+    /* Initialize... */
+    cz[i] = ch[i] = 0;
 
-	/* Set correlation lengths for pressure... */
-	if (iqa[i] == IDXP) {
-	  cz = ret->err_press_cz;
-	  ch = ret->err_press_ch;
-	}
+    /* Set correlation lengths for pressure... */
+    if (iqa[i] == IDXP) {
+      cz[i] = ret->err_press_cz;
+      ch[i] = ret->err_press_ch;
+    }
 
-	/* Set correlation lengths for temperature... */
-	if (iqa[i] == IDXT) {
-	  cz = ret->err_temp_cz;
-	  ch = ret->err_temp_ch;
-	}
+    /* Set correlation lengths for temperature... */
+    if (iqa[i] == IDXT) {
+      cz[i] = ret->err_temp_cz;
+      ch[i] = ret->err_temp_ch;
+    }
 
-	/* Set correlation lengths for volume mixing ratios... */
-	for (int ig = 0; ig < ctl->ng; ig++)
-	  if (iqa[i] == IDXQ(ig)) {
-	    cz = ret->err_q_cz[ig];
-	    ch = ret->err_q_ch[ig];
-	  }
+    /* Set correlation lengths for volume mixing ratios... */
+    for (int ig = 0; ig < ctl->ng; ig++)
+      if (iqa[i] == IDXQ(ig)) {
+	cz[i] = ret->err_q_cz[ig];
+	ch[i] = ret->err_q_ch[ig];
+      }
 
-	/* Set correlation lengths for extinction... */
-	for (int iw = 0; iw < ctl->nw; iw++)
-	  if (iqa[i] == IDXK(iw)) {
-	    cz = ret->err_k_cz[iw];
-	    ch = ret->err_k_ch[iw];
-	  }
+    /* Set correlation lengths for extinction... */
+    for (int iw = 0; iw < ctl->nw; iw++)
+      if (iqa[i] == IDXK(iw)) {
+	cz[i] = ret->err_k_cz[iw];
+	ch[i] = ret->err_k_ch[iw];
+      }
 
-	/* Compute correlations... */
-	if (cz > 0 && ch > 0) {
+    /* Get Cartesian coordinates... */
+    geo2cart(0, atm->lon[ipa[i]], atm->lat[ipa[i]], &xc[3 * i]);
+  }
+
+  /* Get maximum exponent from correlation cut-off... */
+  const double dmax =
+    (ret->err_rho_min > 0 ? -log(ret->err_rho_min) : GSL_POSINF);
 
-	  /* Get Cartesian coordinates... */
-	  double x0[3], x1[3];
-	  geo2cart(0, atm->lon[ipa[i]], atm->lat[ipa[i]], x0);
-	  geo2cart(0, atm->lon[ipa[j]], atm->lat[ipa[j]], x1);
+  /* Loop over matrix elements of the same quantity
+     (state vector elements of each quantity are contiguous)... */
+#pragma omp parallel for schedule(dynamic) default(none) shared(n,iqa,ipa,atm,x_a,s_a,ch,cz,xc,dmax)
+  for (size_t i = 0; i < n; i++)
+    if (cz[i] > 0 && ch[i] > 0)
+      for (size_t j = i + 1; j < n && iqa[j] == iqa[i]; j++) {
 
-	  /* Compute correlations... */
-	  const double rho =
-	    exp(-DIST(x0, x1) / ch -
-		fabs(atm->z[ipa[i]] - atm->z[ipa[j]]) / cz);
+	/* Compute correlations... */
+	const double *x0 = xc + 3 * i, *x1 = xc + 3 * j;
+	const double d = DIST(x0, x1) / ch[i]
+	  + fabs(atm->z[ipa[i]] - atm->z[ipa[j]]) / cz[i];
+	if (d > dmax)
+	  continue;
+	const double rho = exp(-d);
+
+	/* Set covariance... */
+	const double cov = gsl_vector_get(x_a, i) * gsl_vector_get(x_a, j) * rho;
+	gsl_matrix_set(s_a, i, j, cov);
+	gsl_matrix_set(s_a, j, i, cov);
+      }
 
-	  /* Set covariance... */
-	  gsl_matrix_set(s_a, i, j, gsl_vector_get(x_a, i)
-			 * gsl_vector_get(x_a, j) * rho);
+  /* Check that truncated blocks are positive definite
+     (trial Cholesky decomposition)... */
+  if (ret->err_rho_min > 0)
+    for (size_t i0 = 0, i1; i0 < n; i0 = i1) {
+      for (i1 = i0 + 1; i1 < n && iqa[i1] == iqa[i0];)
+	i1++;
+      const size_t nb = i1 - i0;
+      gsl_matrix *l = gsl_matrix_alloc(nb, nb);
+      gsl_matrix_const_view blk =
+	gsl_matrix_const_submatrix(s_a, i0, i0, nb, nb);
+      gsl_matrix_memcpy(l, &blk.matrix);
+      for (size_t j = 0; j < nb; j++) {
+	double *lj = l->data + j * l->tda;
+	double djj = lj[j];
+	for (size_t k = 0; k < j; k++)
+	  djj -= POW2(lj[k]);
+	if (!(djj > 0))
+	  ERRMSG("A priori covariance is not positive definite"
+		 " (quantity %d), decrease ERR_RHO_MIN!", iqa[i0]);
+	lj[j] = sqrt(djj);
+	for (size_t i = j + 1; i < nb; i++) {
+	  double *li = l->data + i * l->tda;
+	  double dij = li[j];
+	  for (size_t k = 0; k < j; k++)
+	    dij -= li[k] * lj[k];
+	  li[j] = dij / lj[j];
 	}
       }
+      gsl_matrix_free(l);
+    }
 
   /* Free... */
+  free(ch);
+  free(cz);
+  free(xc);
   gsl_vector_free(x_a);
 }
 
@@ -6452,26 +8232,29 @@ void set_cov_meas(
   gsl_vector *sig_formod,
   gsl_vector *sig_eps_inv) {
 
-  static obs_t obs_err;
+  obs_t *obs_err;
 
   /* Get size... */
   const size_t m = sig_eps_inv->size;
 
+  /* Allocate... */
+  ALLOC(obs_err, obs_t, 1);
+
   /* Noise error (always considered in retrieval fit)... */
-  copy_obs(ctl, &obs_err, obs, 1);
-  for (int ir = 0; ir < obs_err.nr; ir++)
+  copy_obs(ctl, obs_err, obs, 1);
+  for (int ir = 0; ir < obs_err->nr; ir++)
     for (int id = 0; id < ctl->nd; id++)
-      obs_err.rad[id][ir]
+      obs_err->rad[id][ir]
 	= (isfinite(obs->rad[id][ir]) ? ret->err_noise[id] : NAN);
-  obs2y(ctl, &obs_err, sig_noise, NULL, NULL);
+  obs2y(ctl, obs_err, sig_noise, NULL, NULL);
 
   /* Forward model error (always considered in retrieval fit)... */
-  copy_obs(ctl, &obs_err, obs, 1);
-  for (int ir = 0; ir < obs_err.nr; ir++)
+  copy_obs(ctl, obs_err, obs, 1);
+  for (int ir = 0; ir < obs_err->nr; ir++)
     for (int id = 0; id < ctl->nd; id++)
-      obs_err.rad[id][ir]
+      obs_err->rad[id][ir]
 	= fabs(ret->err_formod[id] / 100 * obs->rad[id][ir]);
-  obs2y(ctl, &obs_err, sig_formod, NULL, NULL);
+  obs2y(ctl, obs_err, sig_formod, NULL, NULL);
 
   /* Total error... */
   for (size_t i = 0; i < m; i++)
@@ -6484,6 +8267,10 @@ void set_cov_meas(
   for (size_t i = 0; i < m; i++)
     if (gsl_vector_get(sig_eps_inv, i) <= 0)
       ERRMSG("Check measurement errors (zero standard deviation)!");
+
+  /* Free... */
+  free_obs(obs_err);
+  free(obs_err);
 }
 
 /*****************************************************************************/
@@ -6574,6 +8361,8 @@ void timer(
 
   static int l0[10], nt;
 
+#pragma omp threadprivate(w0, l0, nt)
+
   /* Start new timer... */
   if (mode == 1) {
     w0[nt] = omp_get_wtime();
@@ -6601,6 +8390,217 @@ void timer(
 
 /*****************************************************************************/
 
+void warm_check(
+  const ret_t *ret,
+  const ctl_t *ctl,
+  const warm_t *warm,
+  const atm_t *atm,
+  const obs_t *obs,
+  int *use_atm,
+  int *use_k) {
+
+  double x0[3], x1[3];
+
+  /* Initialize... */
+  *use_atm = *use_k = 0;
+
+  /* Check atmospheric grid... */
+  if (warm->atm.np != atm->np)
+    return;
+  for (int ip = 0; ip < atm->np; ip++) {
+    if (fabs(warm->atm.z[ip] - atm->z[ip]) > 1e-6)
+      return;
+    geo2cart(0, warm->atm.lon[ip], warm->atm.lat[ip], x0);
+    geo2cart(0, atm->lon[ip], atm->lat[ip], x1);
+    if (DIST(x0, x1) > ret->warm_dh)
+      return;
+  }
+  *use_atm = 1;
+
+  /* Check observation geometry... */
+  if (warm->obs.nr != obs->nr)
+    return;
+  for (int ir = 0; ir < obs->nr; ir++) {
+    if (fabs(warm->obs.obsz[ir] - obs->obsz[ir]) > ret->warm_dz
+	|| fabs(warm->obs.vpz[ir] - obs->vpz[ir]) > ret->warm_dz)
+      return;
+    geo2cart(0, warm->obs.obslon[ir], warm->obs.obslat[ir], x0);
+    geo2cart(0, obs->obslon[ir], obs->obslat[ir], x1);
+    if (DIST(x0, x1) > ret->warm_dh)
+      return;
+    geo2cart(0, warm->obs.vplon[ir], warm->obs.vplat[ir], x0);
+    geo2cart(0, obs->vplon[ir], obs->vplat[ir], x1);
+    if (DIST(x0, x1) > ret->warm_dh)
+      return;
+
+    /* Check measurement vector layout... */
+    for (int id = 0; id < ctl->nd; id++)
+      if (isfinite(warm->obs.rad[id][ir]) != isfinite(obs->rad[id][ir]))
+	return;
+  }
+  *use_k = 1;
+}
+
+/*****************************************************************************/
+
+void write_async_flush(
+  void) {
+
+  /* Check if writer is running... */
+  pthread_mutex_lock(&wrt_mutex);
+  if (!wrt_running) {
+    pthread_mutex_unlock(&wrt_mutex);
+    return;
+  }
+
+  /* Stop writer after the last job... */
+  wrt_stop = 1;
+  pthread_cond_broadcast(&wrt_cond);
+  pthread_mutex_unlock(&wrt_mutex);
+  if (pthread_join(wrt_thread, NULL) != 0)
+    ERRMSG("Cannot join output thread!");
+
+  /* Free... */
+  free(wrt_queue);
+  wrt_queue = NULL;
+  wrt_running = 0;
+
+  /* Raise error of failed job... */
+  if (wrt_error[0] != '\0')
+    ERRMSG("Asynchronous output failed: %s", wrt_error);
+}
+
+/*****************************************************************************/
+
+void write_async_run(
+  wrt_job_t *job) {
+
+  /* Write data... */
+  const char *dirname = (job->dirname[0] != '\0' ? job->dirname : NULL);
+  if (job->type == 1)
+    write_atm(dirname, job->filename, job->ctl, job->atm);
+  else if (job->type == 2)
+    write_obs(dirname, job->filename, job->ctl, job->obs);
+  else if (job->type == 3)
+    write_matrix(dirname, job->filename, job->ctl, job->matrix, job->atm,
+		 job->obs, job->rowspace, job->colspace, job->sort);
+  else
+    ERRMSG("Unknown output job!");
+
+  /* Free... */
+  if (job->atm != NULL) {
+    free_atm(job->atm);
+    free(job->atm);
+  }
+  if (job->obs != NULL) {
+    free_obs(job->obs);
+    free(job->obs);
+  }
+  if (job->matrix != NULL)
+    gsl_matrix_free(job->matrix);
+  free(job->ctl);
+  free(job);
+}
+
+/*****************************************************************************/
+
+void write_async_submit(
+  const ctl_t *ctl,
+  wrt_job_t *job) {
+
+  pthread_mutex_lock(&wrt_mutex);
+
+  /* Raise error of failed job... */
+  if (wrt_error[0] != '\0') {
+    pthread_mutex_unlock(&wrt_mutex);
+    ERRMSG("Asynchronous output failed: %s", wrt_error);
+  }
+
+  /* Start writer... */
+  if (!wrt_running) {
+    wrt_nmax = ctl->write_async;
+    ALLOC(wrt_queue, wrt_job_t *,
+	  wrt_nmax);
+    wrt_n = wrt_head = wrt_stop = 0;
+    if (pthread_create(&wrt_thread, NULL, write_async_thread, NULL) != 0)
+      ERRMSG("Cannot create output thread!");
+    wrt_running = 1;
+  }
+
+  /* Wait for free slot (bounded queue)... */
+  while (wrt_n >= wrt_nmax)
+    pthread_cond_wait(&wrt_cond, &wrt_mutex);
+
+  /* Add job... */
+  wrt_queue[(wrt_head + wrt_n) % wrt_nmax] = job;
+  wrt_n++;
+  pthread_cond_broadcast(&wrt_cond);
+  pthread_mutex_unlock(&wrt_mutex);
+}
+
+/*****************************************************************************/
+
+void *write_async_thread(
+  void *arg) {
+
+  (void) arg;
+
+  pthread_mutex_lock(&wrt_mutex);
+  for (;;) {
+
+    /* Wait for next job... */
+    while (wrt_n == 0 && !wrt_stop)
+      pthread_cond_wait(&wrt_cond, &wrt_mutex);
+    if (wrt_n == 0)
+      break;
+
+    /* Take job from queue... */
+    wrt_job_t *job = wrt_queue[wrt_head];
+    wrt_head = (wrt_head + 1) % wrt_nmax;
+    wrt_n--;
+    pthread_cond_broadcast(&wrt_cond);
+    pthread_mutex_unlock(&wrt_mutex);
+
+    /* Write data... */
+    write_async_try(job);
+
+    pthread_mutex_lock(&wrt_mutex);
+  }
+  pthread_mutex_unlock(&wrt_mutex);
+
+  return NULL;
+}
+
+/*****************************************************************************/
+
+int write_async_try(
+  wrt_job_t *job) {
+
+  jmp_buf env;
+
+  /* Catch errors of the output routines... */
+  if (setjmp(env) != 0) {
+    err_jmp = NULL;
+    pthread_mutex_lock(&wrt_mutex);
+    if (wrt_error[0] == '\0')
+      sprintf(wrt_error, "%s%s%s", job->dirname,
+	      job->dirname[0] != '\0' ? "/" : "", job->filename);
+    pthread_mutex_unlock(&wrt_mutex);
+    return 1;
+  }
+
+  /* Write data (buffer log messages)... */
+  err_jmp = &env;
+  log_buffer_open();
+  write_async_run(job);
+  log_buffer_close();
+  err_jmp = NULL;
+
+  return 0;
+}
+
+/*****************************************************************************/
+
 void write_atm(
   const char *dirname,
   const char *filename,
@@ -6611,6 +8611,8 @@ void write_atm(
 
   char file[LEN];
 
+  PROF_START(write_atm);
+
   /* Set filename... */
   if (dirname != NULL)
     sprintf(file, "%s/%s", dirname, filename);
@@ -6632,6 +8634,10 @@ void write_atm(
   else if (ctl->atmfmt == 2)
     write_atm_bin(out, ctl, atm);
 
+  /* Write memory-mappable binary file... */
+  else if (ctl->atmfmt == 3)
+    write_atm_map(out, ctl, atm, 1);
+
   /* Error... */
   else
     ERRMSG("Unknown file format, check ATMFMT!");
@@ -6673,6 +8679,8 @@ void write_atm(
 	atm->sft, atm->sfeps[0], atm->sfeps[ctl->nsf - 1]);
   } else
     LOG(2, "Surface layer: none");
+
+  PROF_STOP(write_atm);
 }
 
 /*****************************************************************************/
@@ -6738,6 +8746,61 @@ void write_atm_asc(
 
 /*****************************************************************************/
 
+void write_atm_async(
+  const char *dirname,
+  const char *filename,
+  const ctl_t *ctl,
+  const atm_t *atm) {
+
+  /* Write synchronously... */
+  if (ctl->write_async <= 0) {
+    write_atm(dirname, filename, ctl, atm);
+    return;
+  }
+
+  /* Copy data... */
+  atm_t *atm2;
+  ALLOC(atm2, atm_t, 1);
+  copy_atm(ctl, atm2, atm, 0);
+
+  /* Submit job... */
+  write_atm_async_own(dirname, filename, ctl, atm2);
+}
+
+/*****************************************************************************/
+
+void write_atm_async_own(
+  const char *dirname,
+  const char *filename,
+  const ctl_t *ctl,
+  atm_t *atm) {
+
+  /* Write synchronously... */
+  if (ctl->write_async <= 0) {
+    write_atm(dirname, filename, ctl, atm);
+    free_atm(atm);
+    free(atm);
+    return;
+  }
+
+  /* Create job... */
+  wrt_job_t *job;
+  ALLOC(job, wrt_job_t, 1);
+  job->type = 1;
+  sprintf(job->dirname, "%s", dirname != NULL ? dirname : "");
+  sprintf(job->filename, "%s", filename);
+  ALLOC(job->ctl, ctl_t, 1);
+  memcpy(job->ctl, ctl, sizeof(ctl_t));
+
+  /* Take over data... */
+  job->atm = atm;
+
+  /* Submit job... */
+  write_async_submit(ctl, job);
+}
+
+/*****************************************************************************/
+
 void write_atm_bin(
   FILE *out,
   const ctl_t *ctl,
@@ -6814,6 +8877,81 @@ void write_atm_bin(
 
 /*****************************************************************************/
 
+void write_atm_map(
+  FILE *out,
+  const ctl_t *ctl,
+  const atm_t *atm,
+  const int nrec) {
+
+  size_t *len, *n, *off;
+
+  /* Allocate... */
+  ALLOC(len, size_t, nrec);
+  ALLOC(n, size_t, nrec);
+  ALLOC(off, size_t, nrec);
+
+  /* Write header and index... */
+  const int dim[4] = { ctl->ng, ctl->nw, ctl->ncl, ctl->nsf };
+  for (int irec = 0; irec < nrec; irec++) {
+    n[irec] = (size_t) atm[irec].np;
+    len[irec] = ((6 + (size_t) (ctl->ng + ctl->nw)) * n[irec]
+		 + 3 + (size_t) (ctl->ncl + ctl->nsf)) * sizeof(double);
+  }
+  write_map_header(out, "ATM2", dim, 4, (size_t) nrec, n, len, off);
+
+  /* Write records... */
+  for (int irec = 0; irec < nrec; irec++) {
+    const atm_t *a = &atm[irec];
+    const size_t np = n[irec];
+    if (fseek(out, (long) off[irec], SEEK_SET) != 0)
+      ERRMSG("Seek error in write_atm_map!");
+    FWRITE(a->time, double,
+	   np,
+	   out);
+    FWRITE(a->z, double,
+	   np,
+	   out);
+    FWRITE(a->lon, double,
+	   np,
+	   out);
+    FWRITE(a->lat, double,
+	   np,
+	   out);
+    FWRITE(a->p, double,
+	   np,
+	   out);
+    FWRITE(a->t, double,
+	   np,
+	   out);
+    for (int ig = 0; ig < ctl->ng; ig++)
+      FWRITE(a->q[ig], double,
+	     np,
+	     out);
+    for (int iw = 0; iw < ctl->nw; iw++)
+      FWRITE(a->k[iw], double,
+	     np,
+	     out);
+    double c[3 + NCL + NSF];
+    c[0] = a->clz;
+    c[1] = a->cldz;
+    for (int icl = 0; icl < ctl->ncl; icl++)
+      c[2 + icl] = a->clk[icl];
+    c[2 + ctl->ncl] = a->sft;
+    for (int isf = 0; isf < ctl->nsf; isf++)
+      c[3 + ctl->ncl + isf] = a->sfeps[isf];
+    FWRITE(c, double,
+	     3 + (size_t) (ctl->ncl + ctl->nsf),
+	   out);
+  }
+
+  /* Free... */
+  free(len);
+  free(n);
+  free(off);
+}
+
+/*****************************************************************************/
+
 void write_atm_rfm(
   const char *filename,
   const ctl_t *ctl,
@@ -6852,6 +8990,46 @@ void write_atm_rfm(
 
 /*****************************************************************************/
 
+void write_map_header(
+  FILE *out,
+  const char *magic,
+  const int *dim,
+  const int ndim,
+  const size_t nrec,
+  const size_t *n,
+  const size_t *len,
+  size_t *off) {
+
+  /* Get record offsets (aligned to MAPALIGN)... */
+  size_t pos =
+    4 + (size_t) ndim * sizeof(int) + (1 + 3 * nrec) * sizeof(size_t);
+  for (size_t irec = 0; irec < nrec; irec++) {
+    off[irec] = (pos + MAPALIGN - 1) / MAPALIGN * MAPALIGN;
+    pos = off[irec] + len[irec];
+  }
+
+  /* Write header... */
+  FWRITE(magic, char,
+	 4,
+	 out);
+  FWRITE(dim, int,
+	   (size_t) ndim,
+	 out);
+  FWRITE(&nrec, size_t,
+	 1,
+	 out);
+
+  /* Write index... */
+  for (size_t irec = 0; irec < nrec; irec++) {
+    const size_t idx[3] = { off[irec], n[irec], len[irec] };
+    FWRITE(idx, size_t,
+	   3,
+	   out);
+  }
+}
+
+/*****************************************************************************/
+
 void write_matrix(
   const char *dirname,
   const char *filename,
@@ -6865,33 +9043,13 @@ void write_matrix(
 
   FILE *out;
 
-  char file[LEN], quantity[LEN];
-
-  int *cida, *ciqa, *cipa, *cira, *rida, *riqa, *ripa, *rira;
-
-  size_t i, j, nc, nr;
+  char file[LEN];
 
   /* Check output flag... */
   if (!ctl->write_matrix)
     return;
 
-  /* Allocate... */
-  ALLOC(cida, int,
-	M);
-  ALLOC(ciqa, int,
-	N);
-  ALLOC(cipa, int,
-	N);
-  ALLOC(cira, int,
-	M);
-  ALLOC(rida, int,
-	M);
-  ALLOC(riqa, int,
-	N);
-  ALLOC(ripa, int,
-	N);
-  ALLOC(rira, int,
-	M);
+  PROF_START(write_matrix);
 
   /* Set filename... */
   if (dirname != NULL)
@@ -6906,6 +9064,60 @@ void write_matrix(
   if (!(out = fopen(file, "w")))
     ERRMSG("Cannot create file!");
 
+  /* Write ASCII file... */
+  if (ctl->matrixfmt == 1)
+    write_matrix_asc(out, ctl, matrix, atm, obs, rowspace, colspace, sort);
+
+  /* Write binary file... */
+  else if (ctl->matrixfmt == 2)
+    write_matrix_bin(out, ctl, matrix, atm, obs, rowspace, colspace);
+
+  /* Error... */
+  else
+    ERRMSG("Unknown matrix file format, check MATRIXFMT!");
+
+  /* Close file... */
+  fclose(out);
+
+  PROF_STOP(write_matrix);
+}
+
+/*****************************************************************************/
+
+void write_matrix_asc(
+  FILE *out,
+  const ctl_t *ctl,
+  const gsl_matrix *matrix,
+  const atm_t *atm,
+  const obs_t *obs,
+  const char *rowspace,
+  const char *colspace,
+  const char *sort) {
+
+  char quantity[LEN];
+
+  int *cida, *ciqa, *cipa, *cira, *rida, *riqa, *ripa, *rira;
+
+  size_t i, j, nc, nr;
+
+  /* Allocate... */
+  ALLOC(cida, int,
+	matrix->size2);
+  ALLOC(ciqa, int,
+	matrix->size2);
+  ALLOC(cipa, int,
+	matrix->size2);
+  ALLOC(cira, int,
+	matrix->size2);
+  ALLOC(rida, int,
+	matrix->size1);
+  ALLOC(riqa, int,
+	matrix->size1);
+  ALLOC(ripa, int,
+	matrix->size1);
+  ALLOC(rira, int,
+	matrix->size1);
+
   /* Write header (row space)... */
   if (rowspace[0] == 'y') {
 
@@ -7014,9 +9226,6 @@ void write_matrix(
     }
   }
 
-  /* Close file... */
-  fclose(out);
-
   /* Free... */
   free(cida);
   free(ciqa);
@@ -7030,6 +9239,188 @@ void write_matrix(
 
 /*****************************************************************************/
 
+void write_matrix_async(
+  const char *dirname,
+  const char *filename,
+  const ctl_t *ctl,
+  const gsl_matrix *matrix,
+  const atm_t *atm,
+  const obs_t *obs,
+  const char *rowspace,
+  const char *colspace,
+  const char *sort) {
+
+  /* Write synchronously (or skip)... */
+  if (ctl->write_async <= 0 || !ctl->write_matrix) {
+    write_matrix(dirname, filename, ctl, matrix, atm, obs, rowspace,
+		 colspace, sort);
+    return;
+  }
+
+  /* Copy matrix... */
+  gsl_matrix *matrix2 = gsl_matrix_alloc(matrix->size1, matrix->size2);
+  gsl_matrix_memcpy(matrix2, matrix);
+
+  /* Submit job... */
+  write_matrix_async_own(dirname, filename, ctl, matrix2, atm, obs, rowspace,
+			 colspace, sort);
+}
+
+/*****************************************************************************/
+
+void write_matrix_async_own(
+  const char *dirname,
+  const char *filename,
+  const ctl_t *ctl,
+  gsl_matrix *matrix,
+  const atm_t *atm,
+  const obs_t *obs,
+  const char *rowspace,
+  const char *colspace,
+  const char *sort) {
+
+  /* Write synchronously (or skip)... */
+  if (ctl->write_async <= 0 || !ctl->write_matrix) {
+    write_matrix(dirname, filename, ctl, matrix, atm, obs, rowspace,
+		 colspace, sort);
+    gsl_matrix_free(matrix);
+    return;
+  }
+
+  /* Create job... */
+  wrt_job_t *job;
+  ALLOC(job, wrt_job_t, 1);
+  job->type = 3;
+  sprintf(job->dirname, "%s", dirname != NULL ? dirname : "");
+  sprintf(job->filename, "%s", filename);
+  ALLOC(job->ctl, ctl_t, 1);
+  memcpy(job->ctl, ctl, sizeof(ctl_t));
+
+  /* Take over matrix and copy data... */
+  job->matrix = matrix;
+  if (atm != NULL) {
+    ALLOC(job->atm, atm_t, 1);
+    copy_atm(ctl, job->atm, atm, 0);
+  }
+  if (obs != NULL) {
+    ALLOC(job->obs, obs_t, 1);
+    copy_obs(ctl, job->obs, obs, 0);
+  }
+  sprintf(job->rowspace, "%s", rowspace);
+  sprintf(job->colspace, "%s", colspace);
+  sprintf(job->sort, "%s", sort);
+
+  /* Submit job... */
+  write_async_submit(ctl, job);
+}
+
+/*****************************************************************************/
+
+void write_matrix_bin(
+  FILE *out,
+  const ctl_t *ctl,
+  const gsl_matrix *matrix,
+  const atm_t *atm,
+  const obs_t *obs,
+  const char *rowspace,
+  const char *colspace) {
+
+  int *id, *ir;
+
+  double *time, *z, *lon, *lat;
+
+  size_t n[2];
+
+  /* Allocate... */
+  size_t nmax = GSL_MAX(matrix->size1, matrix->size2);
+  ALLOC(id, int,
+	nmax);
+  ALLOC(ir, int,
+	nmax);
+  ALLOC(time, double,
+	nmax);
+  ALLOC(z, double,
+	nmax);
+  ALLOC(lon, double,
+	nmax);
+  ALLOC(lat, double,
+	nmax);
+
+  /* Get matrix size... */
+  n[0] = (rowspace[0] == 'y' ? obs2y(ctl, obs, NULL, NULL, NULL)
+	  : atm2x(ctl, atm, NULL, NULL, NULL));
+  n[1] = (colspace[0] == 'y' ? obs2y(ctl, obs, NULL, NULL, NULL)
+	  : atm2x(ctl, atm, NULL, NULL, NULL));
+  if (n[0] != matrix->size1 || n[1] != matrix->size2)
+    ERRMSG("Matrix size does not match row or column space!");
+
+  /* Write header... */
+  FWRITE("MAT1", char,
+	 4,
+	 out);
+  FWRITE(rowspace, char,
+	 1,
+	 out);
+  FWRITE(colspace, char,
+	 1,
+	 out);
+  FWRITE(n, size_t,
+	 2,
+	 out);
+
+  /* Write descriptor tables of row and column space... */
+  for (int k = 0; k < 2; k++) {
+    if ((k == 0 ? rowspace : colspace)[0] == 'y') {
+      obs2y(ctl, obs, NULL, id, ir);
+      for (size_t i = 0; i < n[k]; i++) {
+	time[i] = obs->time[ir[i]];
+	z[i] = obs->vpz[ir[i]];
+	lon[i] = obs->vplon[ir[i]];
+	lat[i] = obs->vplat[ir[i]];
+      }
+    } else {
+      atm2x(ctl, atm, NULL, id, ir);
+      for (size_t i = 0; i < n[k]; i++) {
+	time[i] = atm->time[ir[i]];
+	z[i] = atm->z[ir[i]];
+	lon[i] = atm->lon[ir[i]];
+	lat[i] = atm->lat[ir[i]];
+      }
+    }
+    FWRITE(id, int,
+	   n[k],
+	   out);
+    FWRITE(time, double,
+	   n[k],
+	   out);
+    FWRITE(z, double,
+	   n[k],
+	   out);
+    FWRITE(lon, double,
+	   n[k],
+	   out);
+    FWRITE(lat, double,
+	   n[k],
+	   out);
+  }
+
+  /* Write matrix data (row-major order)... */
+  for (size_t i = 0; i < n[0]; i++)
+    FWRITE(gsl_matrix_const_ptr(matrix, i, 0), double,
+	   n[1],
+	   out);
+
+  /* Free... */
+  free(id);
+  free(ir);
+  free(time);
+  free(z);
+  free(lon);
+  free(lat);
+}
+
+/*****************************************************************************/
+
 void write_obs(
   const char *dirname,
   const char *filename,
@@ -7040,6 +9431,8 @@ void write_obs(
 
   char file[LEN];
 
+  PROF_START(write_obs);
+
   /* Set filename... */
   if (dirname != NULL)
     sprintf(file, "%s/%s", dirname, filename);
@@ -7061,6 +9454,10 @@ void write_obs(
   else if (ctl->obsfmt == 2)
     write_obs_bin(out, ctl, obs);
 
+  /* Write memory-mappable binary data... */
+  else if (ctl->obsfmt == 3)
+    write_obs_map(out, ctl, obs, 1);
+
   /* Error... */
   else
     ERRMSG("Unknown observation file format, check OBSFMT!");
@@ -7108,6 +9505,8 @@ void write_obs(
 	  ctl->nu[id], mini, maxi);
     }
   }
+
+  PROF_STOP(write_obs);
 }
 
 /*****************************************************************************/
@@ -7117,34 +9516,49 @@ void write_obs_asc(
   const ctl_t *ctl,
   const obs_t *obs) {
 
+  /* Write header and all ray paths... */
+  write_obs_asc_chunk(out, ctl, obs, 1, NAN);
+}
+
+/*****************************************************************************/
+
+void write_obs_asc_chunk(
+  FILE *out,
+  const ctl_t *ctl,
+  const obs_t *obs,
+  const int header,
+  const double t0) {
+
   int n = 10;
 
   /* Write header... */
-  fprintf(out,
-	  "# $1 = time (seconds since 2000-01-01T00:00Z)\n"
-	  "# $2 = observer altitude [km]\n"
-	  "# $3 = observer longitude [deg]\n"
-	  "# $4 = observer latitude [deg]\n"
-	  "# $5 = view point altitude [km]\n"
-	  "# $6 = view point longitude [deg]\n"
-	  "# $7 = view point latitude [deg]\n"
-	  "# $8 = tangent point altitude [km]\n"
-	  "# $9 = tangent point longitude [deg]\n"
-	  "# $10 = tangent point latitude [deg]\n");
-  for (int id = 0; id < ctl->nd; id++)
-    if (ctl->write_bbt)
-      fprintf(out, "# $%d = brightness temperature (%.4f cm^-1) [K]\n",
-	      ++n, ctl->nu[id]);
-    else
-      fprintf(out, "# $%d = radiance (%.4f cm^-1) [W/(m^2 sr cm^-1)]\n",
-	      ++n, ctl->nu[id]);
-  for (int id = 0; id < ctl->nd; id++)
-    fprintf(out, "# $%d = transmittance (%.4f cm^-1) [-]\n", ++n,
-	    ctl->nu[id]);
+  if (header) {
+    fprintf(out,
+	    "# $1 = time (seconds since 2000-01-01T00:00Z)\n"
+	    "# $2 = observer altitude [km]\n"
+	    "# $3 = observer longitude [deg]\n"
+	    "# $4 = observer latitude [deg]\n"
+	    "# $5 = view point altitude [km]\n"
+	    "# $6 = view point longitude [deg]\n"
+	    "# $7 = view point latitude [deg]\n"
+	    "# $8 = tangent point altitude [km]\n"
+	    "# $9 = tangent point longitude [deg]\n"
+	    "# $10 = tangent point latitude [deg]\n");
+    for (int id = 0; id < ctl->nd; id++)
+      if (ctl->write_bbt)
+	fprintf(out, "# $%d = brightness temperature (%.4f cm^-1) [K]\n",
+		++n, ctl->nu[id]);
+      else
+	fprintf(out, "# $%d = radiance (%.4f cm^-1) [W/(m^2 sr cm^-1)]\n",
+		++n, ctl->nu[id]);
+    for (int id = 0; id < ctl->nd; id++)
+      fprintf(out, "# $%d = transmittance (%.4f cm^-1) [-]\n", ++n,
+	      ctl->nu[id]);
+  }
 
   /* Write data... */
   for (int ir = 0; ir < obs->nr; ir++) {
-    if (ir == 0 || obs->time[ir] != obs->time[ir - 1])
+    if (obs->time[ir] != (ir == 0 ? t0 : obs->time[ir - 1]))
       fprintf(out, "\n");
     fprintf(out, "%.2f %g %g %g %g %g %g %g %g %g", obs->time[ir],
 	    obs->obsz[ir], obs->obslon[ir], obs->obslat[ir],
@@ -7160,6 +9574,37 @@ void write_obs_asc(
 
 /*****************************************************************************/
 
+void write_obs_async(
+  const char *dirname,
+  const char *filename,
+  const ctl_t *ctl,
+  const obs_t *obs) {
+
+  /* Write synchronously... */
+  if (ctl->write_async <= 0) {
+    write_obs(dirname, filename, ctl, obs);
+    return;
+  }
+
+  /* Create job... */
+  wrt_job_t *job;
+  ALLOC(job, wrt_job_t, 1);
+  job->type = 2;
+  sprintf(job->dirname, "%s", dirname != NULL ? dirname : "");
+  sprintf(job->filename, "%s", filename);
+  ALLOC(job->ctl, ctl_t, 1);
+  memcpy(job->ctl, ctl, sizeof(ctl_t));
+
+  /* Copy data... */
+  ALLOC(job->obs, obs_t, 1);
+  copy_obs(ctl, job->obs, obs, 0);
+
+  /* Submit job... */
+  write_async_submit(ctl, job);
+}
+
+/*****************************************************************************/
+
 void write_obs_bin(
   FILE *out,
   const ctl_t *ctl,
@@ -7220,6 +9665,168 @@ void write_obs_bin(
 
 /*****************************************************************************/
 
+void write_obs_map(
+  FILE *out,
+  const ctl_t *ctl,
+  const obs_t *obs,
+  const int nrec) {
+
+  size_t *len, *n, *off;
+
+  /* Allocate... */
+  ALLOC(len, size_t, nrec);
+  ALLOC(n, size_t, nrec);
+  ALLOC(off, size_t, nrec);
+
+  /* Write header and index... */
+  for (int irec = 0; irec < nrec; irec++) {
+    n[irec] = (size_t) obs[irec].nr;
+    len[irec] = (10 + 2 * (size_t) ctl->nd) * n[irec] * sizeof(double);
+  }
+  write_map_header(out, "OBS2", &ctl->nd, 1, (size_t) nrec, n, len, off);
+
+  /* Write records... */
+  for (int irec = 0; irec < nrec; irec++) {
+    const obs_t *o = &obs[irec];
+    const size_t nr = n[irec];
+    if (fseek(out, (long) off[irec], SEEK_SET) != 0)
+      ERRMSG("Seek error in write_obs_map!");
+    FWRITE(o->time, double,
+	   nr,
+	   out);
+    FWRITE(o->obsz, double,
+	   nr,
+	   out);
+    FWRITE(o->obslon, double,
+	   nr,
+	   out);
+    FWRITE(o->obslat, double,
+	   nr,
+	   out);
+    FWRITE(o->vpz, double,
+	   nr,
+	   out);
+    FWRITE(o->vplon, double,
+	   nr,
+	   out);
+    FWRITE(o->vplat, double,
+	   nr,
+	   out);
+    FWRITE(o->tpz, double,
+	   nr,
+	   out);
+    FWRITE(o->tplon, double,
+	   nr,
+	   out);
+    FWRITE(o->tplat, double,
+	   nr,
+	   out);
+    for (int id = 0; id < ctl->nd; id++)
+      FWRITE(o->rad[id], double,
+	     nr,
+	     out);
+    for (int id = 0; id < ctl->nd; id++)
+      FWRITE(o->tau[id], double,
+	     nr,
+	     out);
+  }
+
+  /* Free... */
+  free(len);
+  free(n);
+  free(off);
+}
+
+/*****************************************************************************/
+
+void write_prf_close(
+  prf_t *prf) {
+
+  /* Check handle... */
+  if (!prf || !prf->fp || !prf->dirty)
+    ERRMSG("Invalid output container!");
+
+  /* Check records... */
+  for (size_t i = 0; i < prf->n; i++)
+    if (prf->offset[i] <= 0)
+      ERRMSG("Record %zu of profile container was not written!", i);
+
+  /* Write index... */
+  if (fseek(prf->fp, (long) (4 + 5 * sizeof(int) + sizeof(size_t)),
+	    SEEK_SET) != 0)
+    ERRMSG("Seek error in write_prf_close!");
+  FWRITE(prf->offset, int64_t, prf->n, prf->fp);
+
+  /* Close file... */
+  if (fclose(prf->fp) != 0)
+    ERRMSG("Error while closing profile container!");
+  free(prf->offset);
+  memset(prf, 0, sizeof(*prf));
+}
+
+/*****************************************************************************/
+
+void write_prf_create(
+  const char *filename,
+  const ctl_t *ctl,
+  const size_t n,
+  prf_t *prf) {
+
+  /* Write info... */
+  LOG(1, "Write profile container: %s", filename);
+
+  /* Create file... */
+  memset(prf, 0, sizeof(*prf));
+  if (!(prf->fp = fopen(filename, "w")))
+    ERRMSG("Cannot create file!");
+
+  /* Write header... */
+  const int dim[5] = { ctl->ng, ctl->nw, ctl->ncl, ctl->nsf, ctl->nd };
+  FWRITE("PRF1", char,
+	 4,
+	 prf->fp);
+  FWRITE(dim, int,
+	 5,
+	 prf->fp);
+  FWRITE(&n, size_t,
+	 1,
+	 prf->fp);
+
+  /* Write empty index (updated on close)... */
+  prf->n = n;
+  ALLOC(prf->offset, int64_t, n);
+  FWRITE(prf->offset, int64_t, n, prf->fp);
+  prf->dirty = 1;
+}
+
+/*****************************************************************************/
+
+void write_prf_single(
+  prf_t *prf,
+  const ctl_t *ctl,
+  const size_t rec,
+  const atm_t *atm,
+  const obs_t *obs) {
+
+  /* Check record index... */
+  if (rec >= prf->n)
+    ERRMSG("Record index %zu out of range!", rec);
+
+  /* Append record (the file position is shared between threads)... */
+#pragma omp critical (prf_io)
+  {
+    if (fseek(prf->fp, 0, SEEK_END) != 0)
+      ERRMSG("Seek error in write_prf_single!");
+    prf->offset[rec] = (int64_t) ftell(prf->fp);
+    if (prf->offset[rec] <= 0)
+      ERRMSG("ftell failed in write_prf_single!");
+    write_atm_bin(prf->fp, ctl, atm);
+    write_obs_bin(prf->fp, ctl, obs);
+  }
+}
+
+/*****************************************************************************/
+
 void write_shape(
   const char *filename,
   const double *x,
@@ -7255,30 +9862,33 @@ void write_stddev(
   const ret_t *ret,
   const ctl_t *ctl,
   const atm_t *atm,
-  const gsl_matrix *s) {
+  const gsl_vector *var) {
 
-  static atm_t atm_aux;
+  atm_t *atm_aux;
 
   char filename[LEN];
 
   /* Get sizes... */
-  const size_t n = s->size1;
+  const size_t n = var->size;
 
   /* Allocate... */
+  ALLOC(atm_aux, atm_t, 1);
   gsl_vector *x_aux = gsl_vector_alloc(n);
 
   /* Compute standard deviation... */
   for (size_t i = 0; i < n; i++)
-    gsl_vector_set(x_aux, i, sqrt(gsl_matrix_get(s, i, i)));
+    gsl_vector_set(x_aux, i, sqrt(gsl_vector_get(var, i)));
 
   /* Write to disk... */
-  copy_atm(ctl, &atm_aux, atm, 1);
-  x2atm(ctl, x_aux, &atm_aux);
+  copy_atm(ctl, atm_aux, atm, 1);
+  x2atm(ctl, x_aux, atm_aux);
   sprintf(filename, "atm_err_%s.tab", quantity);
-  write_atm(ret->dir, filename, ctl, &atm_aux);
+  write_atm_async(ret->dir, filename, ctl, atm_aux);
 
   /* Free... */
   gsl_vector_free(x_aux);
+  free_atm(atm_aux);
+  free(atm_aux);
 }
 
 /*****************************************************************************/
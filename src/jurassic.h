@@ -104,6 +104,7 @@
    Includes...
    ------------------------------------------------------------ */
 
+#include <ctype.h>
 #include <errno.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_blas.h>
@@ -111,13 +112,18 @@
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_statistics.h>
+#include <limits.h>
 #include <math.h>
 #include <omp.h>
+#include <pthread.h>
+#include <setjmp.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <time.h>
+#include <unistd.h>
 
 /* ------------------------------------------------------------
    Constants...
@@ -242,16 +248,6 @@
 #define NG 8
 #endif
 
-/*! Maximum number of atmospheric data points. */
-#ifndef NP
-#define NP 256
-#endif
-
-/*! Maximum number of ray paths. */
-#ifndef NR
-#define NR 256
-#endif
-
 /*! Maximum number of surface layer spectral grid points. */
 #ifndef NSF
 #define NSF 8
@@ -267,26 +263,11 @@
 #define LEN 10000
 #endif
 
-/*! Maximum size of measurement vector. */
-#ifndef M
-#define M (NR*ND)
-#endif
-
-/*! Maximum size of state vector. */
-#ifndef N
-#define N ((2 + NG + NW) * NP + NCL + NSF + 3)
-#endif
-
 /*! Maximum number of quantities. */
 #ifndef NQ
 #define NQ (5 + NG + NW + NCL + NSF)
 #endif
 
-/*! Maximum number of LOS points. */
-#ifndef NLOS
-#define NLOS 4096
-#endif
-
 /*! Maximum number of shape function grid points. */
 #ifndef NSHAPE
 #define NSHAPE 20000
@@ -317,6 +298,31 @@
 #define TBLNS 1200
 #endif
 
+/*! Alignment of records in memory-mappable binary files [bytes]. */
+#ifndef MAPALIGN
+#define MAPALIGN 4096
+#endif
+
+/*! Maximum number of profiling scopes. */
+#ifndef PROFNS
+#define PROFNS 64
+#endif
+
+/*! Maximum number of profiling call-tree nodes per thread. */
+#ifndef PROFNN
+#define PROFNN 512
+#endif
+
+/*! Maximum nesting depth of profiling scopes. */
+#ifndef PROFND
+#define PROFND 32
+#endif
+
+/*! Number of bins of the LOS length histogram (powers of two). */
+#ifndef CNTNH
+#define CNTNH 16
+#endif
+
 /*! Maximum number of frequency-table entries allowed in a gas table file. */
 #ifndef MAX_TABLES
 #define MAX_TABLES 10000
@@ -568,7 +574,7 @@
  */
 #define LOGX(x0, y0, x1, y1, x) \
   (((x)/(x0)>0 && (x1)/(x0)>0) \
-   ? ((y0)+((y1)-(y0))*log((x)/(x0))/log((x1)/(x0))) \
+   ? ((y0)+((y1)-(y0))*MLOG((x)/(x0))/MLOG((x1)/(x0))) \
    : LIN(x0, y0, x1, y1, x))
 
 /**
@@ -591,7 +597,7 @@
  */
 #define LOGY(x0, y0, x1, y1, x) \
   (((y1)/(y0)>0) \
-   ? ((y0)*exp(log((y1)/(y0))/((x1)-(x0))*((x)-(x0)))) \
+   ? ((y0)*MEXP(MLOG((y1)/(y0))/((x1)-(x0))*((x)-(x0)))) \
    : LIN(x0, y0, x1, y1, x))
 
 /**
@@ -613,7 +619,7 @@
  */
 #define LOGXY(x0, y0, x1, y1, x) \
   (((x0) > 0 && (x1) > 0 && (x) > 0 && (y0) > 0 && (y1) > 0) \
-   ? ((y0) * exp(log((y1)/(y0)) * log((x)/(x0)) / log((x1)/(x0)))) \
+   ? ((y0) * MEXP(MLOG((y1)/(y0)) * MLOG((x)/(x0)) / MLOG((x1)/(x0)))) \
    : LIN(x0, y0, x1, y1, x))
 
 
@@ -760,7 +766,7 @@
  * @see BRIGHT, C1, C2
  */
 #define PLANCK(T, nu) \
-  (C1 * POW3(nu) / gsl_expm1(C2 * (nu) / (T)))
+  (C1 * POW3(nu) / MEXPM1(C2 * (nu) / (T)))
 
 /**
  * @brief Compute the square of a value.
@@ -836,6 +842,54 @@
 #define TIMER(name, mode) \
   {timer(name, __FILE__, __func__, __LINE__, mode);}
 
+/**
+ * @brief Open a profiling scope.
+ *
+ * Starts timing of the named scope on the calling thread. Scopes must
+ * be closed with @ref PROF_STOP in reverse order. The scope name must be
+ * a valid identifier; it is registered on first use (@ref prof_register).
+ * The cached scope index is accessed atomically, so that threads entering
+ * the scope for the first time at once may all register it safely.
+ * Without `-DTIMERS` (`make TIMERS=1`), the macro expands to nothing.
+ *
+ * @param[in] name Scope name.
+ *
+ * @see PROF_STOP, prof_start
+ *
+ * @author Lars Hoffmann
+ */
+#ifdef TIMERS
+#define PROF_START(name) \
+  static int prof_id_##name = -1; \
+  int prof_loc_##name; \
+  _Pragma("omp atomic read") \
+  prof_loc_##name = prof_id_##name; \
+  if (prof_loc_##name < 0) { \
+    prof_loc_##name = prof_register(#name); \
+    _Pragma("omp atomic write") \
+    prof_id_##name = prof_loc_##name; \
+  } \
+  prof_start(prof_loc_##name)
+#else
+#define PROF_START(name)
+#endif
+
+/**
+ * @brief Close a profiling scope.
+ *
+ * @param[in] name Scope name (as given to @ref PROF_START).
+ *
+ * @see PROF_START, prof_stop
+ *
+ * @author Lars Hoffmann
+ */
+#ifdef TIMERS
+#define PROF_STOP(name) \
+  prof_stop(prof_loc_##name)
+#else
+#define PROF_STOP(name)
+#endif
+
 /**
  * @brief Tokenize a string and parse a variable.
  *
@@ -860,6 +914,104 @@
     } else ERRMSG("Error while reading!"); \
   }
 
+/**
+ * @brief Parse the next floating-point token of a text line.
+ *
+ * Fast replacement of `TOK` for numeric columns. The token is
+ * converted with scan_tok(), which works in place on the line buffer
+ * and avoids the format parsing of `sscanf()`. Lines with a token that
+ * is not a number are skipped, like with `TOK`.
+ *
+ * @param[in,out] ptr Pointer to the current position in the line buffer.
+ * @param[in] nline Line number (used in error messages).
+ * @param[out] var Variable to store parsed value.
+ *
+ * @see scan_tok, TOK
+ *
+ * @author Lars Hoffmann
+ */
+#define FTOK(ptr, nline, var) { \
+    const int ftok = scan_tok(&(ptr), &(var)); \
+    if (ftok < 0) \
+      ERRMSG("Error while reading line %d!", (nline)); \
+    if (ftok == 0) continue; \
+  }
+
+/* ------------------------------------------------------------
+   Event counters...
+   ------------------------------------------------------------ */
+
+/*! Event counter: calls of intpol_tbl_eps(). */
+#define CNT_EPS 0
+
+/*! Event counter: intpol_tbl_eps() extrapolation below u_min. */
+#define CNT_EPS_LOW 1
+
+/*! Event counter: intpol_tbl_eps() extrapolation above u_max. */
+#define CNT_EPS_HIGH 2
+
+/*! Event counter: calls of intpol_tbl_u(). */
+#define CNT_U 3
+
+/*! Event counter: intpol_tbl_u() extrapolation below eps_min. */
+#define CNT_U_LOW 4
+
+/*! Event counter: intpol_tbl_u() extrapolation above eps_max. */
+#define CNT_U_HIGH 5
+
+/*! Event counter: emissivity set to zero (less than 30 pressure levels). */
+#define CNT_TBL_NP 6
+
+/*! Event counter: emissivity set to zero (less than 2 temperatures
+    or column densities). */
+#define CNT_TBL_NT 7
+
+/*! Event counter: ray paths of the pencil beam forward model. */
+#define CNT_RAY 8
+
+/*! Event counter: LOS points of the pencil beam forward model. */
+#define CNT_LOS 9
+
+/*! Number of event counters. */
+#define CNT_N 10
+
+/**
+ * @brief Increment an event counter of the calling thread.
+ *
+ * Without `-DCOUNTERS` (`make COUNTERS=1`), the macro expands to an
+ * empty block.
+ *
+ * @param[in] ev Event index (`CNT_*`).
+ *
+ * @see cnt_alloc, cnt_write
+ *
+ * @author Lars Hoffmann
+ */
+#ifdef COUNTERS
+#define COUNT(ev) { \
+    if (cnt_local == NULL) \
+      cnt_alloc(); \
+    cnt_local->n[ev]++; \
+  }
+#else
+#define COUNT(ev) {}
+#endif
+
+/**
+ * @brief Count a ray path and its number of LOS points.
+ *
+ * @param[in] np Number of LOS points.
+ *
+ * @see cnt_los
+ *
+ * @author Lars Hoffmann
+ */
+#ifdef COUNTERS
+#define COUNT_LOS(np) cnt_los(np)
+#else
+#define COUNT_LOS(np) {}
+#endif
+
 /* ------------------------------------------------------------
    Log messages...
    ------------------------------------------------------------ */
@@ -869,11 +1021,30 @@
 #define LOGLEV 2
 #endif
 
+/* Thread-local variables below are declared with _Thread_local rather
+   than OpenMP threadprivate, as they are also used by the POSIX thread
+   of the asynchronous writer (see write_async_thread)... */
+
+/*! Output stream of log messages (thread-local, NULL for stdout). */
+extern _Thread_local FILE *log_stream;
+
+/*! Buffer and size of log messages (thread-local, see log_buffer_open). */
+extern _Thread_local char *log_buf;
+extern _Thread_local size_t log_len;
+
+/*! Error handler of the calling thread (thread-local, NULL to exit). */
+extern _Thread_local jmp_buf *err_jmp;
+
+/*! Print to the log stream of the calling thread (or to stdout). */
+#define LOGPRINTF(...)							\
+  (log_stream != NULL ? fprintf(log_stream, __VA_ARGS__) : printf(__VA_ARGS__))
+
 /*!
  * \brief Print a log message with a specified logging level.
  *
- * This macro prints a formatted log message to the standard output if
- * the specified logging level meets certain conditions. The message
+ * This macro prints a formatted log message to the standard output (or
+ * to the thread's @ref log_stream, if set) if the specified logging
+ * level meets certain conditions. The message
  * will be indented if the logging level is greater than or equal to
  * 2.
  * 
@@ -900,10 +1071,10 @@
  */
 #define LOG(level, ...) {						\
     if(level >= 2)							\
-      printf("  ");							\
+      LOGPRINTF("  ");							\
     if(level <= LOGLEV) {						\
-      printf(__VA_ARGS__);						\
-      printf("\n");							\
+      LOGPRINTF(__VA_ARGS__);						\
+      LOGPRINTF("\n");						\
     }									\
   }
 
@@ -936,15 +1107,16 @@
  * @author Lars Hoffmann
  */
 #define WARN(...) {							\
-    printf("\nWarning (%s, %s, l%d): ", __FILE__, __func__, __LINE__);	\
+    LOGPRINTF("\nWarning (%s, %s, l%d): ", __FILE__, __func__, __LINE__); \
     LOG(0, __VA_ARGS__);						\
   }
 
 /*!
  * \brief Print an error message with contextual information and terminate the program.
  *
- * This macro prints a formatted error message to the standard output,
- * including the file name, function name, and line number where the
+ * This macro prints a formatted error message to the standard output
+ * (after writing any buffered log messages of the calling thread, see
+ * @ref log_buffer_close), including the file name, function name, and line number where the
  * error occurred. After printing the message, the program is
  * terminated with an exit status indicating failure.
  * 
@@ -961,17 +1133,21 @@
  * After printing this contextual information, the macro uses the
  * `LOG` macro with a logging level of 0 to print the actual error
  * message. Finally, the program exits with a failure status
- * (`EXIT_FAILURE`).
+ * (`EXIT_FAILURE`) via @ref error_exit.
  *
  * \note
  * The `LOG` macro must be defined before using the `ERRMSG` macro.
+ * If the calling thread has set @ref err_jmp (as the output thread of
+ * the asynchronous writer does), control returns there via `longjmp()`
+ * instead, so that the error can be raised on the main thread.
  * 
  * @author Lars Hoffmann
  */
 #define ERRMSG(...) {							\
+    log_buffer_close();							\
     printf("\nError (%s, %s, l%d): ", __FILE__, __func__, __LINE__);	\
     LOG(0, __VA_ARGS__);						\
-    exit(EXIT_FAILURE);							\
+    error_exit();							\
   }
 
 /*!
@@ -1007,6 +1183,314 @@
   printf("Print (%s, %s, l%d): %s= "format"\n",				\
 	 __FILE__, __func__, __LINE__, #var, var);
 
+/* ------------------------------------------------------------
+   Math backend...
+   ------------------------------------------------------------ */
+
+#ifdef FASTMATH
+
+/*! Exponential function of the math backend. */
+#define MEXP(x) exp_fast(x)
+
+/*! Exponential function minus one of the math backend. */
+#define MEXPM1(x) expm1_fast(x)
+
+/*! Natural logarithm of the math backend. */
+#define MLOG(x) log_fast(x)
+
+/*! Power function of the math backend. */
+#define MPOW(x, y) pow_fast(x, y)
+
+#else
+
+/*! Exponential function of the math backend. */
+#define MEXP(x) exp(x)
+
+/*! Exponential function minus one of the math backend. */
+#define MEXPM1(x) gsl_expm1(x)
+
+/*! Natural logarithm of the math backend. */
+#define MLOG(x) log(x)
+
+/*! Power function of the math backend. */
+#define MPOW(x, y) pow(x, y)
+
+#endif
+
+/**
+ * @brief Fast exponential function.
+ *
+ * Computes exp(x) by range reduction, x = n ln(2) + r with
+ * |r| ≤ ln(2)/2, a degree-13 polynomial for exp(r), and scaling by
+ * 2ⁿ through the exponent bits. The code is free of branches and
+ * library calls, so that loops calling it can be vectorized.
+ *
+ * @param[in] x Argument.
+ *
+ * @return exp(x), accurate to a few ULP.
+ *
+ * @note Results below the smallest normal number are flushed to zero.
+ *
+ * @see MEXP, expm1_fast, log_fast
+ */
+static inline double exp_fast(
+  const double x) {
+
+  /* Limit argument to the range of normal results... */
+  const double xc = (x < -708.0 ? -708.0 : (x > 709.0 ? 709.0 : x));
+
+  /* Range reduction (round to nearest by adding 1.5 * 2^52)... */
+  const double kd = xc * M_LOG2E + 6755399441055744.0;
+  uint64_t ki;
+  memcpy(&ki, &kd, sizeof(double));
+  const double n = kd - 6755399441055744.0;
+  const double r =
+    (xc - n * 6.93147180369123816490e-01) - n * 1.90821492927058770002e-10;
+
+  /* Polynomial approximation of exp(r) (Estrin's scheme)... */
+  const double r2 = r * r, r4 = r2 * r2, r8 = r4 * r4;
+  const double p =
+    (1.0 + r) + r2 * (1.0 / 2.0 + r * (1.0 / 6.0))
+    + r4 * ((1.0 / 24.0 + r * (1.0 / 120.0))
+	    + r2 * (1.0 / 720.0 + r * (1.0 / 5040.0)))
+    + r8 * ((1.0 / 40320.0 + r * (1.0 / 362880.0))
+	    + r2 * (1.0 / 3628800.0 + r * (1.0 / 39916800.0))
+	    + r4 * (1.0 / 479001600.0 + r * (1.0 / 6227020800.0)));
+
+  /* Scale by 2^n... */
+  const uint64_t bits = (ki + 1023) << 52;
+  double scale;
+  memcpy(&scale, &bits, sizeof(double));
+  const double y = p * scale;
+
+  /* Handle overflow, underflow, and NaN... */
+  return (x > 709.0 ? HUGE_VAL : (x < -708.0 ? 0.0 : (x == x ? y : x)));
+}
+
+/**
+ * @brief Fast exponential function minus one.
+ *
+ * Computes exp(x) - 1 with a Taylor polynomial for |x| < 1/2, where
+ * the subtraction would cancel, and with @ref exp_fast otherwise.
+ *
+ * @param[in] x Argument.
+ *
+ * @return exp(x) - 1, accurate to a few ULP.
+ *
+ * @see MEXPM1, exp_fast
+ */
+static inline double expm1_fast(
+  const double x) {
+
+  /* Use exp() if there is no cancellation... */
+  if (!(fabs(x) < 0.5))
+    return exp_fast(x) - 1.0;
+
+  /* Taylor polynomial... */
+  const double x2 = x * x, x4 = x2 * x2, x8 = x4 * x4;
+  const double p =
+    (1.0 / 2.0 + x * (1.0 / 6.0))
+    + x2 * (1.0 / 24.0 + x * (1.0 / 120.0))
+    + x4 * ((1.0 / 720.0 + x * (1.0 / 5040.0))
+	    + x2 * (1.0 / 40320.0 + x * (1.0 / 362880.0)))
+    + x8 * ((1.0 / 3628800.0 + x * (1.0 / 39916800.0))
+	    + x2 * (1.0 / 479001600.0 + x * (1.0 / 6227020800.0))
+	    + x4 * (1.0 / 87178291200.0 + x * (1.0 / 1307674368000.0)));
+
+  return x + x2 * p;
+}
+
+/**
+ * @brief Fast natural logarithm.
+ *
+ * Splits x = m 2ᵉ with m in [√½, √2) through the exponent bits and
+ * evaluates log(m) = 2 atanh(s), s = (m - 1) / (m + 1), with an odd
+ * series up to s²¹. The code is free of branches and library calls,
+ * so that loops calling it can be vectorized.
+ *
+ * @param[in] x Argument.
+ *
+ * @return log(x), accurate to a few ULP.
+ *
+ * @see MLOG, exp_fast, pow_fast
+ */
+static inline double log_fast(
+  const double x) {
+
+  /* Scale subnormal arguments... */
+  const int sub = (x < GSL_DBL_MIN);
+  const double xs = (sub ? x * 4503599627370496.0 : x);
+
+  /* Split into mantissa and exponent (x = m 2^e, 1 <= m < 2)... */
+  uint64_t bits, ebits, mbits;
+  memcpy(&bits, &xs, sizeof(double));
+  ebits = (bits >> 52) | 0x4330000000000000ULL;
+  mbits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+  double e, m;
+  memcpy(&e, &ebits, sizeof(double));
+  memcpy(&m, &mbits, sizeof(double));
+  e -= 4503599627370496.0 + 1023.0 + (sub ? 52.0 : 0.0);
+
+  /* Shift mantissa to [sqrt(1/2), sqrt(2))... */
+  const int shift = (m > M_SQRT2);
+  m = (shift ? 0.5 * m : m);
+  e = (shift ? e + 1.0 : e);
+
+  /* Series expansion of log(m) = 2 atanh(s) (Estrin's scheme)... */
+  const double s = (m - 1.0) / (m + 1.0);
+  const double s2 = s * s, s4 = s2 * s2, s8 = s4 * s4;
+  const double p =
+    (2.0 / 3.0 + s2 * (2.0 / 5.0))
+    + s4 * ((2.0 / 7.0 + s2 * (2.0 / 9.0))
+	    + s4 * (2.0 / 11.0 + s2 * (2.0 / 13.0)))
+    + s8 * s4 * ((2.0 / 15.0 + s2 * (2.0 / 17.0))
+		 + s4 * (2.0 / 19.0 + s2 * (2.0 / 21.0)));
+  const double y = e * 6.93147180369123816490e-01
+    + (2.0 * s + (s * s2 * p + e * 1.90821492927058770002e-10));
+
+  /* Handle zero, negative, infinite, and NaN arguments... */
+  return (x > 0 && x <= GSL_DBL_MAX ? y
+	  : (x == 0 ? -HUGE_VAL : (x > 0 ? x : NAN)));
+}
+
+/**
+ * @brief Fast power function.
+ *
+ * Computes xʸ = exp(y log(x)) with @ref exp_fast and @ref log_fast.
+ * The relative error grows with |y log(x)|, so this is meant for
+ * moderate exponents such as temperature scaling factors.
+ *
+ * @param[in] x Base.
+ * @param[in] y Exponent.
+ *
+ * @return xʸ.
+ *
+ * @note Only positive bases are supported; negative bases give NaN.
+ *
+ * @see MPOW, exp_fast, log_fast
+ */
+static inline double pow_fast(
+  const double x,
+  const double y) {
+
+  return exp_fast(y * log_fast(x));
+}
+
+/* ------------------------------------------------------------
+   Working precision...
+   ------------------------------------------------------------ */
+
+#ifdef SINGLE
+
+/*! Floating-point type for table interpolation and radiance integration. */
+typedef float real_t;
+
+/*! Exponential function in working precision. */
+#define REXP(x) expf(x)
+
+/*! Natural logarithm in working precision. */
+#define RLOG(x) logf(x)
+
+#else
+
+/*! Floating-point type for table interpolation and radiance integration. */
+typedef double real_t;
+
+/*! Exponential function in working precision. */
+#define REXP(x) MEXP(x)
+
+/*! Natural logarithm in working precision. */
+#define RLOG(x) MLOG(x)
+
+#endif
+
+/**
+ * @brief Compute logarithmic interpolation in x (working precision).
+ *
+ * Same as @ref LOGX, but evaluates the logarithms with @ref RLOG so
+ * that the interpolation is carried out in @ref real_t.
+ *
+ * @param[in] x0 Lower x-value.
+ * @param[in] y0 Function value at x₀.
+ * @param[in] x1 Upper x-value.
+ * @param[in] y1 Function value at x₁.
+ * @param[in] x Interpolation point.
+ *
+ * @return Interpolated y-value at x.
+ *
+ * @see LOGX, RLOGXY
+ */
+#define RLOGX(x0, y0, x1, y1, x) \
+  (((x)/(x0)>0 && (x1)/(x0)>0) \
+   ? ((y0)+((y1)-(y0))*RLOG((x)/(x0))/RLOG((x1)/(x0))) \
+   : LIN(x0, y0, x1, y1, x))
+
+/**
+ * @brief Compute logarithmic interpolation in x and y (working precision).
+ *
+ * Same as @ref LOGXY, but evaluates the logarithms and the exponential
+ * with @ref RLOG and @ref REXP so that the interpolation is carried out
+ * in @ref real_t.
+ *
+ * @param[in] x0 Lower x-value.
+ * @param[in] y0 Function value at x₀.
+ * @param[in] x1 Upper x-value.
+ * @param[in] y1 Function value at x₁.
+ * @param[in] x Interpolation point.
+ *
+ * @return Interpolated y-value at x.
+ *
+ * @see LOGXY, RLOGX
+ */
+#define RLOGXY(x0, y0, x1, y1, x) \
+  (((x0) > 0 && (x1) > 0 && (x) > 0 && (y0) > 0 && (y1) > 0) \
+   ? ((y0) * REXP(RLOG((y1)/(y0)) * RLOG((x)/(x0)) / RLOG((x1)/(x0)))) \
+   : LIN(x0, y0, x1, y1, x))
+
+/* ------------------------------------------------------------
+   LAPACK interface...
+   ------------------------------------------------------------ */
+
+#ifdef LAPACK
+
+/*! Cholesky factorization of a symmetric positive-definite matrix. */
+void dpotrf_(
+  const char *uplo,
+  const int *n,
+  double *a,
+  const int *lda,
+  int *info);
+
+/*! Inverse of a symmetric positive-definite matrix from its Cholesky factor. */
+void dpotri_(
+  const char *uplo,
+  const int *n,
+  double *a,
+  const int *lda,
+  int *info);
+
+/*! Inverse of a triangular matrix. */
+void dtrtri_(
+  const char *uplo,
+  const char *diag,
+  const int *n,
+  double *a,
+  const int *lda,
+  int *info);
+
+/*! Solve a linear system using the Cholesky factor of the matrix. */
+void dpotrs_(
+  const char *uplo,
+  const int *n,
+  const int *nrhs,
+  const double *a,
+  const int *lda,
+  double *b,
+  const int *ldb,
+  int *info);
+
+#endif
+
 /* ------------------------------------------------------------
    Structs...
    ------------------------------------------------------------ */
@@ -1016,7 +1500,8 @@
  *
  * Holds one vertical atmospheric column including geolocation,
  * thermodynamic, cloud, and surface properties for radiative-transfer
- * calculations.
+ * calculations. Profile arrays are sized at runtime (@ref alloc_atm,
+ * @ref free_atm).
  */
 typedef struct {
 
@@ -1024,28 +1509,28 @@ typedef struct {
   int np;
 
   /*! Time (seconds since 2000-01-01T00:00Z). */
-  double time[NP];
+  double *time;
 
   /*! Altitude [km]. */
-  double z[NP];
+  double *z;
 
   /*! Longitude [deg]. */
-  double lon[NP];
+  double *lon;
 
   /*! Latitude [deg]. */
-  double lat[NP];
+  double *lat;
 
   /*! Pressure [hPa]. */
-  double p[NP];
+  double *p;
 
   /*! Temperature [K]. */
-  double t[NP];
+  double *t;
 
-  /*! Volume mixing ratio [ppv]. */
-  double q[NG][NP];
+  /*! Volume mixing ratio [ppv] (emitter x data point). */
+  double **q;
 
-  /*! Extinction [km^-1]. */
-  double k[NW][NP];
+  /*! Extinction [km^-1] (window x data point). */
+  double **k;
 
   /*! Cloud layer height [km]. */
   double clz;
@@ -1062,6 +1547,21 @@ typedef struct {
   /*! Surface emissivity. */
   double sfeps[NSF];
 
+  /*! Allocated number of data points. */
+  int np_alloc;
+
+  /*! Allocated number of emitters. */
+  int ng_alloc;
+
+  /*! Allocated number of spectral windows. */
+  int nw_alloc;
+
+  /*! Memory-mapped file region holding the data (NULL if on the heap). */
+  void *map;
+
+  /*! Size of memory-mapped file region [bytes]. */
+  size_t map_len;
+
 } atm_t;
 
 /**
@@ -1127,12 +1627,15 @@ typedef struct {
   /*! Look-up table file format (1=ASCII, 2=binary). */
   int tblfmt;
 
-  /*! Atmospheric data file format (1=ASCII, 2=binary). */
+  /*! Atmospheric data file format (1=ASCII, 2=binary, 3=mapped binary). */
   int atmfmt;
 
-  /*! Observation data file format (1=ASCII, 2=binary). */
+  /*! Observation data file format (1=ASCII, 2=binary, 3=mapped binary). */
   int obsfmt;
 
+  /*! Matrix file format (1=ASCII, 2=binary). */
+  int matrixfmt;
+
   /*! Reference height for hydrostatic pressure profile (-999 to skip) [km]. */
   double hydz;
 
@@ -1214,6 +1717,12 @@ typedef struct {
   /*! Write matrix file (0=no, 1=yes). */
   int write_matrix;
 
+  /*! Queue length of asynchronous output (0=write synchronously). */
+  int write_async;
+
+  /*! Basename of profiling output files (- to disable). */
+  char profile[LEN];
+
   /*! Forward model (0=CGA, 1=EGA, 2=RFM). */
   int formod;
 
@@ -1233,7 +1742,8 @@ typedef struct {
  *
  * Contains all quantities along a ray path used for radiative-transfer
  * calculations, including geometry, thermodynamic state, gas and
- * extinction profiles, and precomputed optical parameters.
+ * extinction profiles, and precomputed optical parameters. Arrays are
+ * sized at runtime (@ref alloc_los, @ref free_los).
  */
 typedef struct {
 
@@ -1241,52 +1751,61 @@ typedef struct {
   int np;
 
   /*! Altitude [km]. */
-  double z[NLOS];
+  double *z;
 
   /*! Longitude [deg]. */
-  double lon[NLOS];
+  double *lon;
 
   /*! Latitude [deg]. */
-  double lat[NLOS];
+  double *lat;
 
   /*! Pressure [hPa]. */
-  double p[NLOS];
+  double *p;
 
   /*! Temperature [K]. */
-  double t[NLOS];
+  double *t;
 
-  /*! Volume mixing ratio [ppv]. */
-  double q[NLOS][NG];
+  /*! Volume mixing ratio [ppv] (LOS point x emitter). */
+  double **q;
 
-  /*! Extinction [km^-1]. */
-  double k[NLOS][ND];
+  /*! Extinction [km^-1] (LOS point x channel). */
+  double **k;
 
   /*! Surface temperature [K]. */
   double sft;
 
   /*! Surface emissivity. */
-  double sfeps[ND];
+  double *sfeps;
 
   /*! Segment length [km]. */
-  double ds[NLOS];
+  double *ds;
 
   /*! Column density [molecules/cm^2]. */
-  double u[NLOS][NG];
+  double **u;
 
   /*! Curtis-Godson pressure [hPa]. */
-  double cgp[NLOS][NG];
+  double **cgp;
 
   /*! Curtis-Godson temperature [K]. */
-  double cgt[NLOS][NG];
+  double **cgt;
 
   /*! Curtis-Godson column density [molecules/cm^2]. */
-  double cgu[NLOS][NG];
+  double **cgu;
 
   /*! Segment emissivity. */
-  double eps[NLOS][ND];
+  double **eps;
 
   /*! Segment source function [W/(m^2 sr cm^-1)]. */
-  double src[NLOS][ND];
+  double **src;
+
+  /*! Allocated number of LOS points. */
+  int np_alloc;
+
+  /*! Allocated number of emitters. */
+  int ng_alloc;
+
+  /*! Allocated number of channels. */
+  int nd_alloc;
 
 } los_t;
 
@@ -1295,7 +1814,8 @@ typedef struct {
  *
  * Stores viewing geometry and radiative quantities for multiple ray paths.
  * Each path represents a line of sight between observer and tangent point,
- * including associated time and location data.
+ * including associated time and location data. Arrays are sized at
+ * runtime (@ref alloc_obs, @ref free_obs).
  */
 typedef struct {
 
@@ -1303,40 +1823,52 @@ typedef struct {
   int nr;
 
   /*! Time (seconds since 2000-01-01T00:00Z). */
-  double time[NR];
+  double *time;
 
   /*! Observer altitude [km]. */
-  double obsz[NR];
+  double *obsz;
 
   /*! Observer longitude [deg]. */
-  double obslon[NR];
+  double *obslon;
 
   /*! Observer latitude [deg]. */
-  double obslat[NR];
+  double *obslat;
 
   /*! View point altitude [km]. */
-  double vpz[NR];
+  double *vpz;
 
   /*! View point longitude [deg]. */
-  double vplon[NR];
+  double *vplon;
 
   /*! View point latitude [deg]. */
-  double vplat[NR];
+  double *vplat;
 
   /*! Tangent point altitude [km]. */
-  double tpz[NR];
+  double *tpz;
 
   /*! Tangent point longitude [deg]. */
-  double tplon[NR];
+  double *tplon;
 
   /*! Tangent point latitude [deg]. */
-  double tplat[NR];
+  double *tplat;
+
+  /*! Transmittance of ray path (channel x ray path). */
+  double **tau;
 
-  /*! Transmittance of ray path. */
-  double tau[ND][NR];
+  /*! Radiance [W/(m^2 sr cm^-1)] (channel x ray path). */
+  double **rad;
 
-  /*! Radiance [W/(m^2 sr cm^-1)]. */
-  double rad[ND][NR];
+  /*! Allocated number of ray paths. */
+  int nr_alloc;
+
+  /*! Allocated number of channels. */
+  int nd_alloc;
+
+  /*! Memory-mapped file region holding the data (NULL if on the heap). */
+  void *map;
+
+  /*! Size of memory-mapped file region [bytes]. */
+  size_t map_len;
 
 } obs_t;
 
@@ -1357,6 +1889,9 @@ typedef struct {
   /*! Re-computation of kernel matrix (number of iterations). */
   int kernel_recomp;
 
+  /*! Broyden update of kernel between re-computations (0=no, 1=yes). */
+  int kernel_broyden;
+
   /*! Maximum number of iterations. */
   int conv_itmax;
 
@@ -1423,6 +1958,18 @@ typedef struct {
   /*! Surface emissivity error. */
   double err_sfeps[NSF];
 
+  /*! Minimum a priori correlation (smaller correlations are set to zero). */
+  double err_rho_min;
+
+  /*! Warm start from previous retrieval (0=no, 1=yes). */
+  int warm_start;
+
+  /*! Maximum horizontal distance for warm start [km]. */
+  double warm_dh;
+
+  /*! Maximum observer and view point altitude change for kernel reuse [km]. */
+  double warm_dz;
+
 } ret_t;
 
 /**
@@ -1504,26 +2051,350 @@ typedef struct {
 
 } tbl_gas_t;
 
-/* ------------------------------------------------------------
-   Functions...
-   ------------------------------------------------------------ */
+/**
+ * @brief Warm-start data from a previous retrieval.
+ *
+ * Holds the final state, the kernel matrix, and the Levenberg–Marquardt
+ * parameter of the last converged retrieval, so that the next retrieval
+ * of a neighbouring profile can start from them (@ref optimal_estimation).
+ * Zero-initialize before first use.
+ */
+typedef struct {
+
+  /*! Data available (0=no, 1=yes). */
+  int ok;
+
+  /*! Levenberg-Marquardt parameter. */
+  double lmpar;
+
+  /*! Retrieved atmospheric state. */
+  atm_t atm;
+
+  /*! Measured observation data. */
+  obs_t obs;
+
+  /*! Kernel matrix. */
+  gsl_matrix *k;
+
+} warm_t;
 
 /**
- * @brief Analyze averaging kernel (AVK) matrix for retrieval diagnostics.
+ * @brief Profile container with N atmospheric profiles and observation sets.
+ *
+ * A single binary file holding many independent retrieval or forward
+ * model cases ("records"), which replaces one directory per case.
+ * The file consists of a header, an index of record offsets, and the
+ * records themselves, each being an `ATM1` block followed by an `OBS1`
+ * block (@ref write_atm_bin, @ref write_obs_bin). Records are accessed
+ * randomly via the index.
+ */
+typedef struct {
+
+  /*! Open file handle, NULL if not open. */
+  FILE *fp;
+
+  /*! Number of records. */
+  size_t n;
+
+  /*! Byte offsets of the records in the file. */
+  int64_t *offset;
+
+  /*! Non-zero if the index must be written on close. */
+  int dirty;
+
+} prf_t;
+
+/**
+ * @brief Parsed control parameters.
  *
- * Decomposes and evaluates the averaging kernel matrix \f$\mathbf{A}\f$
- * to quantify the retrieval sensitivity and vertical resolution for each
- * retrieved quantity (pressure, temperature, trace gases, extinction, etc.).
- * The results are written to diagnostic atmospheric files for visualization.
+ * Hash map of all `NAME VALUE` pairs given in the control file and on
+ * the command line, which is built once by @ref read_ctlmap and then
+ * queried by @ref scan_ctl. Names are stored in lower case, and for
+ * each name only the first occurrence in the control file or on the
+ * command line is kept.
+ */
+typedef struct {
+
+  /*! Number of command-line arguments the map was built from. */
+  int argc;
+
+  /*! Command-line arguments the map was built from. */
+  char **argv;
+
+  /*! Number of hash slots (power of two). */
+  size_t size;
+
+  /*! Variable names (NULL for empty slots). */
+  char **name;
+
+  /*! Variable values. */
+  char **val;
+
+  /*! Source of entry (0=control file, 1=command line). */
+  int *src;
+
+  /*! Position in control file or on command line. */
+  int *pos;
+
+} ctlmap_t;
+
+/**
+ * @brief Per-thread event counters.
  *
- * @param[in]  ret   Retrieval control and configuration structure (`ret_t`).
- * @param[in]  ctl   Global control structure (`ctl_t`) defining retrieval setup and quantities.
- * @param[in]  atm   Retrieved atmospheric state structure (`atm_t`).
- * @param[in]  iqa   Array mapping state vector indices to physical quantities (e.g., IDXP, IDXT, IDXQ(...)).
- * @param[in]  ipa   Array mapping state vector indices to atmospheric grid points.
- * @param[in]  avk   Averaging kernel matrix \f$\mathbf{A}\f$ (`gsl_matrix`, n×n).
+ * Counters are incremented without synchronization by the owning
+ * thread (@ref COUNT). The structures of all threads are linked and
+ * summed up at program exit (@ref cnt_write).
+ */
+typedef struct cnt {
+
+  /*! Event counts (see `CNT_*`). */
+  long n[CNT_N];
+
+  /*! Histogram of LOS points per ray path (bin i: 2^i ... 2^(i+1)-1,
+      last bin open). */
+  long hist[CNTNH];
+
+  /*! Next thread. */
+  struct cnt *next;
+
+} cnt_t;
+
+/*! Event counters of the calling thread (thread-local, NULL if unused). */
+extern _Thread_local cnt_t *cnt_local;
+
+/**
+ * @brief Call-tree node of the profiling timers.
  *
- * @details
+ * Accumulates the wall-clock time of one scope for one calling path
+ * (@ref PROF_START, @ref PROF_STOP).
+ */
+typedef struct {
+
+  /*! Scope index. */
+  int scope;
+
+  /*! Index of parent node (0=root). */
+  int parent;
+
+  /*! Indices of child nodes per scope (0=none). */
+  int child[PROFNS];
+
+  /*! Number of calls. */
+  long count;
+
+  /*! Total time [s]. */
+  double sum;
+
+  /*! Minimum time of a call [s]. */
+  double min;
+
+  /*! Maximum time of a call [s]. */
+  double max;
+
+} prof_node_t;
+
+/**
+ * @brief Per-thread accumulators of the profiling timers.
+ *
+ * Each thread owns a call tree of scopes and a stack of open scopes,
+ * so that timing needs no synchronization. The structures of all
+ * threads are linked for output (@ref prof_write).
+ */
+typedef struct prof_thread {
+
+  /*! Call-tree nodes (node 0 is the root). */
+  prof_node_t node[PROFNN];
+
+  /*! Number of call-tree nodes. */
+  int nnode;
+
+  /*! Nodes of open scopes. */
+  int stack[PROFND];
+
+  /*! Start times of open scopes [s]. */
+  double t0[PROFND];
+
+  /*! Number of open scopes. */
+  int depth;
+
+  /*! Next thread. */
+  struct prof_thread *next;
+
+} prof_thread_t;
+
+/**
+ * @brief Output job of the asynchronous writer.
+ *
+ * Owns a copy of the control parameters and the data to be written,
+ * so that the caller can reuse its buffers as soon as the job has been
+ * submitted. The data are either copies (@ref write_atm_async,
+ * @ref write_obs_async, @ref write_matrix_async) or buffers handed over
+ * by the caller (@ref write_atm_async_own, @ref write_matrix_async_own).
+ */
+typedef struct {
+
+  /*! Type of output (1=atmosphere, 2=observation, 3=matrix). */
+  int type;
+
+  /*! Directory name (empty for none). */
+  char dirname[LEN];
+
+  /*! File name. */
+  char filename[LEN];
+
+  /*! Control parameters. */
+  ctl_t *ctl;
+
+  /*! Atmospheric data. */
+  atm_t *atm;
+
+  /*! Observation geometry and radiance data. */
+  obs_t *obs;
+
+  /*! Matrix. */
+  gsl_matrix *matrix;
+
+  /*! Row space of matrix ("x" or "y"). */
+  char rowspace[LEN];
+
+  /*! Column space of matrix ("x" or "y"). */
+  char colspace[LEN];
+
+  /*! Sort order of matrix output ("r" or "c"). */
+  char sort[LEN];
+
+} wrt_job_t;
+
+/* ------------------------------------------------------------
+   Functions...
+   ------------------------------------------------------------ */
+
+/**
+ * @brief Resize a one-dimensional array.
+ *
+ * Reallocates @p a to hold @p n elements. Existing elements are kept
+ * and new elements are initialized to zero.
+ *
+ * @param[in] a      Array to be resized (may be NULL).
+ * @param[in] n_old  Current number of elements.
+ * @param[in] n      New number of elements.
+ *
+ * @return Pointer to the resized array.
+ *
+ * @throws ERRMSG if memory allocation fails.
+ *
+ * @see alloc_2d
+ */
+double *alloc_1d(
+  double *a,
+  const size_t n_old,
+  const size_t n);
+
+/**
+ * @brief Resize a two-dimensional array.
+ *
+ * Allocates an @p n1 × @p n2 array as a contiguous data block with row
+ * pointers, so that elements can be accessed as `a[i][j]`. The
+ * overlapping part of the old array is copied and the old array is
+ * freed. New elements are initialized to zero.
+ *
+ * @param[in] a       Array to be resized (may be NULL).
+ * @param[in] n1_old  Current number of rows.
+ * @param[in] n2_old  Current number of columns.
+ * @param[in] n1      New number of rows.
+ * @param[in] n2      New number of columns.
+ *
+ * @return Pointer to the resized array (release with @ref free_2d).
+ *
+ * @throws ERRMSG if memory allocation fails.
+ *
+ * @see alloc_1d, free_2d
+ */
+double **alloc_2d(
+  double **a,
+  const size_t n1_old,
+  const size_t n2_old,
+  const size_t n1,
+  const size_t n2);
+
+/**
+ * @brief Allocate memory for atmospheric data.
+ *
+ * Makes sure that @p atm can hold at least @p np data points for the
+ * number of emitters and spectral windows given in @p ctl. Arrays are
+ * grown geometrically and existing data are preserved, so that the
+ * function can be called for each data point while reading a file.
+ *
+ * @param[in]     ctl  Control structure (number of emitters and windows).
+ * @param[in,out] atm  Atmospheric data.
+ * @param[in]     np   Required number of data points.
+ *
+ * @note A zero-initialized @ref atm_t (e.g., declared `static`) is a
+ *       valid empty structure. The number of data points @p atm->np
+ *       is not modified.
+ *
+ * @see free_atm, copy_atm, read_atm
+ */
+void alloc_atm(
+  const ctl_t * ctl,
+  atm_t * atm,
+  const int np);
+
+/**
+ * @brief Allocate memory for line-of-sight data.
+ *
+ * Makes sure that @p los can hold at least @p np LOS points for the
+ * number of emitters and channels given in @p ctl. Arrays are grown
+ * geometrically and existing data are preserved.
+ *
+ * @param[in]     ctl  Control structure (number of emitters and channels).
+ * @param[in,out] los  Line-of-sight data.
+ * @param[in]     np   Required number of LOS points.
+ *
+ * @see free_los, raytrace
+ */
+void alloc_los(
+  const ctl_t * ctl,
+  los_t * los,
+  const int np);
+
+/**
+ * @brief Allocate memory for observation data.
+ *
+ * Makes sure that @p obs can hold at least @p nr ray paths for the
+ * number of channels given in @p ctl. Arrays are grown geometrically
+ * and existing data are preserved.
+ *
+ * @param[in]     ctl  Control structure (number of channels).
+ * @param[in,out] obs  Observation data.
+ * @param[in]     nr   Required number of ray paths.
+ *
+ * @note A zero-initialized @ref obs_t is a valid empty structure.
+ *       The number of ray paths @p obs->nr is not modified.
+ *
+ * @see free_obs, copy_obs, read_obs
+ */
+void alloc_obs(
+  const ctl_t * ctl,
+  obs_t * obs,
+  const int nr);
+
+/**
+ * @brief Analyze averaging kernel (AVK) matrix for retrieval diagnostics.
+ *
+ * Decomposes and evaluates the averaging kernel matrix \f$\mathbf{A}\f$
+ * to quantify the retrieval sensitivity and vertical resolution for each
+ * retrieved quantity (pressure, temperature, trace gases, extinction, etc.).
+ * The results are written to diagnostic atmospheric files for visualization.
+ *
+ * @param[in]  ret   Retrieval control and configuration structure (`ret_t`).
+ * @param[in]  ctl   Global control structure (`ctl_t`) defining retrieval setup and quantities.
+ * @param[in]  atm   Retrieved atmospheric state structure (`atm_t`).
+ * @param[in]  iqa   Array mapping state vector indices to physical quantities (e.g., IDXP, IDXT, IDXQ(...)).
+ * @param[in]  ipa   Array mapping state vector indices to atmospheric grid points.
+ * @param[in]  avk   Averaging kernel matrix \f$\mathbf{A}\f$ (`gsl_matrix`, n×n).
+ *
+ * @details
  * The averaging kernel matrix \f$\mathbf{A}\f$ describes the sensitivity of the
  * retrieved state \f$\hat{x}\f$ to the true state \f$x\f$:
  * \f[
@@ -1898,6 +2769,75 @@ double ctmo2(
   const double p,
   const double t);
 
+/**
+ * @brief Restrict retrieved atmospheric quantities to physical limits.
+ *
+ * Clamps only the elements of @p atm that are part of the state vector,
+ * as given by the index arrays from `atm2x()`.
+ *
+ * @param[in]     ctl  Control structure.
+ * @param[in,out] atm  Atmospheric data.
+ * @param[in]     iqa  Quantity index of each state vector element.
+ * @param[in]     ipa  Profile index of each state vector element.
+ * @param[in]     n    Number of state vector elements.
+ *
+ * @details
+ * Limits are 5e-7...5e4 hPa for pressure, 100...400 K for temperature
+ * and surface temperature, 0...1 for volume mixing ratios and surface
+ * emissivities, at least 0 for extinction, cloud height, and cloud
+ * extinction, and at least 0.1 km for cloud depth.
+ *
+ * @see optimal_estimation, atm2x, x2atm
+ *
+ * @author Lars Hoffmann
+ */
+void clamp_atm(
+  const ctl_t * ctl,
+  atm_t * atm,
+  const int *iqa,
+  const int *ipa,
+  const size_t n);
+
+/**
+ * @brief Allocate the event counters of the calling thread.
+ *
+ * Links the counters into the list of all threads and, on first use,
+ * registers @ref cnt_write to report the counts at program exit.
+ *
+ * @see COUNT, cnt_write
+ *
+ * @author Lars Hoffmann
+ */
+void cnt_alloc(
+  void);
+
+/**
+ * @brief Count a ray path and add it to the LOS length histogram.
+ *
+ * @param[in] np Number of LOS points of the ray path.
+ *
+ * @see COUNT_LOS, cnt_write
+ *
+ * @author Lars Hoffmann
+ */
+void cnt_los(
+  const int np);
+
+/**
+ * @brief Report the event counters of all threads.
+ *
+ * Writes the total number of table interpolations and the fraction of
+ * extrapolations, the number of emissivities set to zero because of
+ * small tables, and the histogram of LOS points per ray path to the
+ * log.
+ *
+ * @see cnt_alloc
+ *
+ * @author Lars Hoffmann
+ */
+void cnt_write(
+  void);
+
 /**
  * @brief Copy or initialize atmospheric profile data.
  *
@@ -2012,6 +2952,18 @@ void doy2day(
   int *mon,
   int *day);
 
+/**
+ * @brief Terminate after an error (see @ref ERRMSG).
+ *
+ * Calls `exit(EXIT_FAILURE)`, unless the calling thread has set an error
+ * handler in @ref err_jmp, in which case control returns there via
+ * `longjmp()`.
+ *
+ * @author Lars Hoffmann
+ */
+_Noreturn void error_exit(
+  void);
+
 /**
  * @brief Find gas species index by name.
  *
@@ -2053,10 +3005,14 @@ int find_emitter(
  *       - 0 or 1 → pencil-beam models (@ref formod_pencil)  
  *       - 2 → RFM line-by-line model (@ref formod_rfm)
  *
+ * @note For the pencil-beam models, rays with identical geometry are
+ *       computed only once and the results are copied to the duplicates
+ *       (@ref formod_dedup).
+ *
  * @note The function preserves @p obs->rad elements marked as invalid
  *       (NaN) by applying an internal observation mask.
  *
- * @see ctl_t, atm_t, obs_t, tbl_t, formod_pencil, formod_rfm, formod_fov, hydrostatic
+ * @see ctl_t, atm_t, obs_t, tbl_t, formod_dedup, formod_pencil, formod_rfm, formod_fov, hydrostatic
  * 
  * @author Lars Hoffmann
  */
@@ -2097,6 +3053,33 @@ void formod_continua(
   const int ip,
   double *beta);
 
+/**
+ * @brief Identify rays with identical viewing geometry.
+ *
+ * Hashes observer and view point coordinates of each ray into an
+ * open-addressing table and maps every ray to the first ray with the
+ * same geometry. The observation time is part of the key only if the
+ * solar zenith angle is derived from it (@ref ctl_t::sftype >= 3 and
+ * @ref ctl_t::sfsza < 0), since it does not affect the pencil beam
+ * calculation otherwise.
+ *
+ * @param[in]  ctl  Control structure (surface and solar settings).
+ * @param[in]  obs  Observation geometry.
+ * @param[out] ref  Index of the reference ray for each ray
+ *                  (ref[ir] == ir for unique rays).
+ *
+ * @return Number of unique rays.
+ *
+ * @note Coordinates are compared exactly; rays that differ only in
+ *       round-off are treated as distinct.
+ *
+ * @see formod, formod_pencil
+ */
+int formod_dedup(
+  const ctl_t * ctl,
+  const obs_t * obs,
+  int *ref);
+
 /**
  * @brief Apply field-of-view (FOV) convolution to modeled radiances.
  *
@@ -2231,6 +3214,52 @@ void formod_srcfunc(
   const double t,
   double *src);
 
+/**
+ * @brief Free a two-dimensional array.
+ *
+ * @param[in] a  Array allocated with @ref alloc_2d (may be NULL).
+ *
+ * @see alloc_2d
+ */
+void free_2d(
+  double **a);
+
+/**
+ * @brief Free memory of atmospheric data.
+ *
+ * Releases all arrays and resets @p atm to an empty structure.
+ *
+ * @param[in,out] atm  Atmospheric data.
+ *
+ * @see alloc_atm
+ */
+void free_atm(
+  atm_t * atm);
+
+/**
+ * @brief Free memory of line-of-sight data.
+ *
+ * Releases all arrays and resets @p los to an empty structure.
+ *
+ * @param[in,out] los  Line-of-sight data.
+ *
+ * @see alloc_los
+ */
+void free_los(
+  los_t * los);
+
+/**
+ * @brief Free memory of observation data.
+ *
+ * Releases all arrays and resets @p obs to an empty structure.
+ *
+ * @param[in,out] obs  Observation data.
+ *
+ * @see alloc_obs
+ */
+void free_obs(
+  obs_t * obs);
+
 /**
  * @brief Converts geographic coordinates (longitude, latitude, altitude) to Cartesian coordinates.
  *
@@ -2498,6 +3527,7 @@ void intpol_tbl_ega(
  * - Applies exponential upper-bound extrapolation ensuring
  *   asymptotic emissivity growth (`eps → 1` as `u → ∞`).
  * - The input arrays are taken from `tbl->u` and `tbl->eps`.
+ * - Computations are done in working precision (@ref real_t).
  *
  * @see tbl_t, LIN, locate_tbl
  *
@@ -2506,13 +3536,13 @@ void intpol_tbl_ega(
  *
  * @author Lars Hoffmann
  */
-double intpol_tbl_eps(
+real_t intpol_tbl_eps(
   const tbl_t * tbl,
   const int ig,
   const int id,
   const int ip,
   const int it,
-  const double u);
+  const real_t u);
 
 /**
  * @brief Interpolate column density from lookup tables as a function
@@ -2538,6 +3568,7 @@ double intpol_tbl_eps(
  * - For `eps > eps_max`, applies exponential extrapolation
  *   following the emissivity growth law.
  * - The lookup is performed using `tbl->eps` and `tbl->u`.
+ * - Computations are done in working precision (@ref real_t).
  *
  * @see tbl_t, LIN, locate_tbl
  *
@@ -2546,13 +3577,13 @@ double intpol_tbl_eps(
  *
  * @author Lars Hoffmann
  */
-double intpol_tbl_u(
+real_t intpol_tbl_u(
   const tbl_t * tbl,
   const int ig,
   const int id,
   const int ip,
   const int it,
-  const double eps);
+  const real_t eps);
 
 /**
  * @brief Converts Julian seconds to calendar date and time components.
@@ -2638,6 +3669,24 @@ void kernel(
   obs_t * obs,
   gsl_matrix * k);
 
+/**
+ * @brief Locate a control parameter in the hash map.
+ *
+ * @param[in] map  Hash map of control parameters.
+ * @param[in] src  Source of entry (0=control file, 1=command line).
+ * @param[in] name Variable name (case-insensitive).
+ * @return Slot of the entry, or the empty slot where it would be
+ *         inserted (`map->name[slot] == NULL`).
+ *
+ * @see read_ctlmap, scan_ctl
+ *
+ * @author Lars Hoffmann
+ */
+size_t locate_ctlmap(
+  const ctlmap_t * map,
+  const int src,
+  const char *name);
+
 /**
  * @brief Locate index for interpolation on an irregular grid.
  *
@@ -2730,6 +3779,69 @@ int locate_tbl(
   const int n,
   const double x);
 
+/**
+ * @brief Write and close the log buffer of the calling thread.
+ *
+ * Closes the buffer opened by log_buffer_open(), writes the buffered
+ * log messages to stdout (serialized between threads), and resets
+ * @ref log_stream. Does nothing if no buffer is open. Called by
+ * @ref ERRMSG, so that the log context of a failing task is not lost.
+ *
+ * @see log_buffer_open, log_stream
+ *
+ * @author Lars Hoffmann
+ */
+void log_buffer_close(
+  void);
+
+/**
+ * @brief Buffer log messages of the calling thread.
+ *
+ * Redirects @ref LOG output of the calling thread into a memory buffer
+ * (@ref log_buf), so that messages of tasks running in parallel are
+ * not interleaved. The buffer is written by log_buffer_close().
+ *
+ * @warning Aborts via `ERRMSG()` if the buffer cannot be opened.
+ *
+ * @see log_buffer_close, log_stream
+ *
+ * @author Lars Hoffmann
+ */
+void log_buffer_open(
+  void);
+
+/**
+ * @brief Compute the inverse Cholesky factor of a symmetric positive-definite matrix.
+ *
+ * Factorizes \f$\mathbf{A} = \mathbf{L}\mathbf{L}^T\f$ and replaces the
+ * lower triangle of \f$\mathbf{A}\f$ by \f$\mathbf{W} = \mathbf{L}^{-1}\f$.
+ *
+ * @param[in,out] a  Symmetric positive-definite matrix; its lower triangle
+ *                   is overwritten by \f$\mathbf{L}^{-1}\f$.
+ *
+ * @details
+ * Since \f$\mathbf{A}^{-1} = \mathbf{W}^T\mathbf{W}\f$, selected elements
+ * of the inverse can be obtained from \f$\mathbf{W}\f$ without forming the
+ * full inverse, e.g. the diagonal
+ * \f$(\mathbf{A}^{-1})_{ii} = \sum_{k \ge i} W_{ki}^2\f$.
+ * This costs about half of the operations of `matrix_invert()`.
+ * If compiled with `-DLAPACK`, the LAPACK routines `dpotrf` and `dtrtri`
+ * are used instead of GSL.
+ *
+ * @see matrix_invert, optimal_estimation
+ *
+ * @note
+ * - Only the lower triangle of the result is meaningful; the upper
+ *   triangle is unspecified.
+ *
+ * @warning
+ * Aborts with an error message if \f$\mathbf{A}\f$ is not positive-definite.
+ *
+ * @author Lars Hoffmann
+ */
+void matrix_inv_chol(
+  gsl_matrix * a);
+
 /*!
  * @brief Invert a square matrix, optimized for diagonal or symmetric positive-definite matrices.
  *
@@ -2749,11 +3861,12 @@ int locate_tbl(
  * \mathbf{A} = \mathbf{L}\mathbf{L}^T
  * \f]
  * followed by inversion using the Cholesky factors, yielding
- * \f$\mathbf{A}^{-1}\f$.
+ * \f$\mathbf{A}^{-1}\f$. If compiled with `-DLAPACK`, the LAPACK
+ * routines `dpotrf` and `dpotri` are used instead of GSL.
  *
  * This approach assumes \f$\mathbf{A}\f$ is **symmetric and positive-definite**.
  *
- * @see gsl_linalg_cholesky_decomp, gsl_linalg_cholesky_invert
+ * @see gsl_linalg_cholesky_decomp, gsl_linalg_cholesky_invert, matrix_solve
  *
  * @note
  * - The inversion is performed **in place**; the input matrix is overwritten.
@@ -2792,7 +3905,8 @@ void matrix_invert(
  * @details
  * - The function internally forms the scaled matrix
  *   \f$(B^{1/2} A)\f$ or \f$(A B^{1/2})\f$, then multiplies it using
- *   BLAS `dgemm` routines for efficiency:
+ *   the BLAS symmetric rank-k update `dsyrk`, which computes only the
+ *   lower triangle; the upper triangle is filled by copying:
  *   \f[
  *   A^T B A = (B^{1/2}A)^T (B^{1/2}A), \quad
  *   A B A^T = (A B^{1/2}) (A B^{1/2})^T
@@ -2801,12 +3915,12 @@ void matrix_invert(
  * - This operation is typically used in computing gain matrices,
  *   propagated covariances, or sensitivity matrices in retrieval algorithms.
  *
- * @see gsl_blas_dgemm, matrix_invert
+ * @see gsl_blas_dsyrk, matrix_invert
  *
  * @note
  * - Assumes \f$\mathbf{B}\f$ is diagonal (provided as a vector of its diagonal elements).
  * - The output matrix \f$\mathbf{C}\f$ must be pre-allocated to the correct size.
- * - No symmetry enforcement or normalization is applied.
+ * - The result is exactly symmetric; no normalization is applied.
  *
  * @warning
  * - If `transpose` is not 1 or 2, the function performs no operation.
@@ -2821,6 +3935,38 @@ void matrix_product(
   const int transpose,
   gsl_matrix * c);
 
+/**
+ * @brief Solve a symmetric positive-definite linear system.
+ *
+ * Solves \f$\mathbf{A}\mathbf{x} = \mathbf{b}\f$ by means of a
+ * Cholesky decomposition of \f$\mathbf{A}\f$.
+ *
+ * @param[in,out] a  Symmetric positive-definite matrix; overwritten by
+ *                   its Cholesky factor.
+ * @param[in] b      Right-hand side vector.
+ * @param[out] x     Solution vector.
+ *
+ * @details
+ * By default the GSL routines `gsl_linalg_cholesky_decomp` and
+ * `gsl_linalg_cholesky_solve` are used. If compiled with `-DLAPACK`,
+ * the LAPACK routines `dpotrf` and `dpotrs` are called directly, which
+ * is considerably faster for large matrices when linked against an
+ * optimized LAPACK library.
+ *
+ * @see matrix_invert
+ *
+ * @note
+ * - Only the lower triangle of \f$\mathbf{A}\f$ is referenced.
+ * - With LAPACK, \f$\mathbf{x}\f$ must have unit stride.
+ *
+ * @warning
+ * Aborts with an error message if \f$\mathbf{A}\f$ is not positive-definite.
+ */
+void matrix_solve(
+  gsl_matrix * a,
+  const gsl_vector * b,
+  gsl_vector * x);
+
 /**
  * @brief Convert observation radiances into a measurement vector.
  *
@@ -2873,8 +4019,8 @@ size_t obs2y(
  * or the maximum number of iterations is reached. Optionally, the full retrieval
  * error budget and averaging kernel analysis are computed.
  *
- * @param[out] ret       Retrieval configuration and output container. Determines convergence,
- *                       kernel recomputation frequency, and error analysis options.
+ * @param[in]  ret       Retrieval configuration. Determines convergence, kernel
+ *                       recomputation frequency, error analysis options, and output directory.
  * @param[in]  ctl       Control parameters describing problem setup (grids, species, etc.).
  * @param[in]  tbl       Lookup tables required by the forward model.
  * @param[in]  obs_meas  Measured observations used as input.
@@ -2882,16 +4028,45 @@ size_t obs2y(
  * @param[in]  atm_apr   A priori atmospheric state used as reference.
  * @param[out] atm_i     Atmospheric state vector to be iteratively retrieved and updated.
  * @param[out] chisq     Final value of the cost function (χ²) upon convergence.
+ * @param[in,out] warm   Warm-start data (may be NULL). If compatible data of a
+ *                       previous retrieval are available (see `warm_check()`),
+ *                       its final state, Levenberg–Marquardt parameter and, if
+ *                       the geometry matches, kernel matrix are used as
+ *                       starting point. The data are replaced by the results
+ *                       of this retrieval if it converges.
  *
  * @note
  * - Aborts early if the problem dimension is zero (no observations or unknowns).
  * - State updates are constrained to physically meaningful bounds (pressure, temperature, etc.).
+ * - Trial steps only update and clamp the retrieved elements of the
+ *   atmospheric state in place. If no trial step is accepted, the
+ *   state, the simulated radiances, and the cost function are rolled
+ *   back to the start of the iteration.
+ * - With `ret->kernel_broyden`, the kernel matrix is updated by Broyden
+ *   rank-one corrections from the accepted steps, and `kernel()` is only
+ *   called again if no step is accepted or if convergence needs to be
+ *   confirmed with an exact kernel. `ret->kernel_recomp` is then ignored.
+ * - A warm-start kernel is treated as approximate: convergence is only
+ *   accepted after `kernel()` has been called at the current state.
+ * - If the final kernel is approximate (Broyden update or warm start),
+ *   it is recomputed at the final state before the error analysis and
+ *   before it is stored as warm-start data.
+ * - The a priori covariance is block-diagonal by quantity. It is inverted
+ *   block by block, and only the diagonal blocks of \f$\mathbf{S_a}^{-1}\f$
+ *   enter the Levenberg–Marquardt matrix and the gradient.
  * - Matrix computations are performed using GSL (GNU Scientific Library).
  * - If retrieval error analysis is enabled (`ret->err_ana`), the function produces:
  *   - Retrieval covariance matrix
  *   - Error decomposition (noise, forward model)
  *   - Gain matrix
  *   - Averaging kernel matrix and diagnostic analysis
+ * - If matrix output is disabled (`ctl->write_matrix`), only the standard
+ *   deviations and the averaging kernel diagnostics are computed. The
+ *   retrieval covariance is then not inverted explicitly; its diagonal is
+ *   obtained from the inverse Cholesky factor (see `matrix_inv_chol()`).
+ * - All workspace is owned by the call, and @p ret, @p ctl, and @p tbl are
+ *   only read, so independent retrievals can run concurrently in separate
+ *   threads that share one look-up table.
  *
  * @warning
  * Input structures must be properly initialized. The function allocates several GSL matrices
@@ -2906,49 +4081,128 @@ size_t obs2y(
  * @author Lars Hoffmann
  */
 void optimal_estimation(
-  ret_t * ret,
-  ctl_t * ctl,
-  tbl_t * tbl,
+  const ret_t * ret,
+  const ctl_t * ctl,
+  const tbl_t * tbl,
   obs_t * obs_meas,
   obs_t * obs_i,
   atm_t * atm_apr,
   atm_t * atm_i,
-  double *chisq);
+  double *chisq,
+  warm_t * warm);
 
 /**
- * @brief Perform line-of-sight (LOS) ray tracing through the atmosphere.
- *
- * Computes the geometric path of a viewing ray from the observer to the
- * atmosphere (and possibly the surface), accounting for spherical geometry,
- * optional refraction, and cloud or surface interactions.  
- * Fills the LOS structure with pressure, temperature, gas concentrations,
- * extinction, and path length at each step.
+ * @brief Enable output of the profiling timers.
  *
- * @param[in]  ctl  Control structure containing model and numerical settings.
- * @param[in]  atm  Atmospheric state structure (profiles of p, T, q, k, etc.).
- * @param[in,out] obs  Observation geometry and radiance data; updated tangent point.
- * @param[out] los  Line-of-sight structure to be populated with sampled quantities.
- * @param[in]  ir   Index of the current ray path in the observation set.
+ * Registers @ref prof_write to be called at program exit. Called by
+ * @ref read_ctl if the control parameter `PROFILE` is set and the code
+ * was compiled with `TIMERS=1`.
  *
- * @details
- * - Integrates along the viewing ray starting at the observer position.
- * - Performs stepwise propagation with step length `ds` determined by
- *   altitude and user-specified controls (`rayds`, `raydz`).
- * - Interpolates atmospheric variables at each step using @ref intpol_atm.
- * - Detects surface intersection or top-of-atmosphere exit and terminates accordingly.
- * - Optionally accounts for **refraction** via the refractive index `n(p, T)`.
- * - Accumulates **column densities** and **Curtis–Godson means** for each gas.
- * - Supports **cloud extinction** and **surface emissivity** interpolation.
+ * @param[in] basename Basename of output files (`.json` and `.csv`
+ *                     are appended).
  *
- * @note
- * The routine enforces that atmospheric grids include the surface (z = 0 km).
- * Rays starting above the atmosphere are propagated downward until entry.
+ * @see prof_write
+ *
+ * @author Lars Hoffmann
+ */
+void prof_init(
+  const char *basename);
+
+/**
+ * @brief Register a profiling scope.
+ *
+ * @param[in] name Scope name.
+ * @return Scope index (the same index for repeated calls with the
+ *         same name).
+ *
+ * @see PROF_START
+ *
+ * @author Lars Hoffmann
+ */
+int prof_register(
+  const char *name);
+
+/**
+ * @brief Start timing of a profiling scope on the calling thread.
+ *
+ * The scope becomes a child of the innermost open scope of the calling
+ * thread. Scopes opened by worker threads of a parallel region start
+ * at the top level of that thread's call tree.
+ *
+ * @param[in] id Scope index (@ref prof_register).
+ *
+ * @see PROF_START, prof_stop
+ *
+ * @author Lars Hoffmann
+ */
+void prof_start(
+  const int id);
+
+/**
+ * @brief Stop timing of a profiling scope on the calling thread.
+ *
+ * Updates call count and total, minimum, and maximum time of the
+ * current call-tree node. Aborts if `id` is not the innermost open
+ * scope.
+ *
+ * @param[in] id Scope index (@ref prof_register).
+ *
+ * @see PROF_STOP, prof_start
+ *
+ * @author Lars Hoffmann
+ */
+void prof_stop(
+  const int id);
+
+/**
+ * @brief Write the profiling timers to JSON and CSV files.
+ *
+ * Merges the call trees of all threads by calling path (e.g.,
+ * `optimal_estimation/kernel/formod`) and writes, for each path, the
+ * number of threads and calls as well as the total, minimum, mean, and
+ * maximum wall-clock time per call.
+ *
+ * @see prof_init
+ *
+ * @author Lars Hoffmann
+ */
+void prof_write(
+  void);
+
+/**
+ * @brief Perform line-of-sight (LOS) ray tracing through the atmosphere.
+ *
+ * Computes the geometric path of a viewing ray from the observer to the
+ * atmosphere (and possibly the surface), accounting for spherical geometry,
+ * optional refraction, and cloud or surface interactions.  
+ * Fills the LOS structure with pressure, temperature, gas concentrations,
+ * extinction, and path length at each step.
+ *
+ * @param[in]  ctl  Control structure containing model and numerical settings.
+ * @param[in]  atm  Atmospheric state structure (profiles of p, T, q, k, etc.).
+ * @param[in,out] obs  Observation geometry and radiance data; updated tangent point.
+ * @param[out] los  Line-of-sight structure to be populated with sampled quantities.
+ * @param[in]  ir   Index of the current ray path in the observation set.
+ *
+ * @details
+ * - Integrates along the viewing ray starting at the observer position.
+ * - Performs stepwise propagation with step length `ds` determined by
+ *   altitude and user-specified controls (`rayds`, `raydz`).
+ * - Interpolates atmospheric variables at each step using @ref intpol_atm.
+ * - Detects surface intersection or top-of-atmosphere exit and terminates accordingly.
+ * - Optionally accounts for **refraction** via the refractive index `n(p, T)`.
+ * - Accumulates **column densities** and **Curtis–Godson means** for each gas.
+ * - Supports **cloud extinction** and **surface emissivity** interpolation.
+ *
+ * @note
+ * The routine enforces that atmospheric grids include the surface (z = 0 km).
+ * Rays starting above the atmosphere are propagated downward until entry.
  *
  * @see intpol_atm, tangent_point, formod_pencil, hydrostatic
  *
  * @warning
  * - Fails if the observer is below the surface or the atmosphere lacks z = 0.
- * - Aborts if the number of LOS points exceeds `NLOS`.
+ * - LOS arrays are grown as needed (@ref alloc_los).
  * - Assumes monotonic altitude ordering in atmospheric data.
  *
  * @author Lars Hoffmann
@@ -3051,9 +4305,10 @@ void read_atm(
  * @note The function continues reading until EOF is reached. Each successfully
  *       parsed line increments the atmospheric data point counter.
  *
- * @warning The function terminates execution using `ERRMSG` if more than
- *          `NP` data points are encountered, or if the input format deviates
- *          from expectations.
+ * @note Memory for the data points is allocated on the fly (@ref alloc_atm).
+ *
+ * @warning The function terminates execution using `ERRMSG` if the input
+ *          format deviates from expectations.
  *
  * @author Lars Hoffmann
  */
@@ -3116,6 +4371,33 @@ void read_atm_bin(
   const ctl_t * ctl,
   atm_t * atm);
 
+/**
+ * @brief Map atmospheric data from a memory-mappable binary file.
+ *
+ * Maps one record of a file written by write_atm_map() into memory
+ * (`mmap`, private copy-on-write mapping) and sets the profile arrays
+ * of @p atm to views into the mapped pages. No data are copied, and
+ * the page cache is shared between processes reading the same file.
+ *
+ * @param in   Pointer to an open binary input file stream.
+ * @param ctl  Pointer to control structure (checked against the header).
+ * @param rec  Record index.
+ * @param atm  Atmospheric data; previous contents are released.
+ *
+ * @note The mapping is released by free_atm(). If the arrays need to
+ *       grow, alloc_atm() first moves the data to the heap. The
+ *       mapping remains valid after the file is closed.
+ *
+ * @see write_atm_map, read_map_rec
+ *
+ * @author Lars Hoffmann
+ */
+void read_atm_map(
+  FILE * in,
+  const ctl_t * ctl,
+  const size_t rec,
+  atm_t * atm);
+
 /**
  * @brief Read model control parameters from command-line and configuration input.
  *
@@ -3161,6 +4443,88 @@ void read_ctl(
   char *argv[],
   ctl_t * ctl);
 
+/**
+ * @brief Parse control file and command line into a hash map.
+ *
+ * Reads all lines of the form `NAME = VALUE` from the control file
+ * (`argv[1]`, unless it starts with '-') and all `NAME VALUE` pairs
+ * from the command line. Only the first occurrence of each name per
+ * source is kept, so that the precedence of @ref scan_ctl is the same
+ * as when scanning the file line by line. A previous map is freed.
+ *
+ * @param[in]  argc Number of command-line arguments.
+ * @param[in]  argv Command-line argument vector.
+ * @param[in,out] map Hash map (zero-initialized on first use).
+ *
+ * @see scan_ctl, locate_ctlmap
+ *
+ * @author Lars Hoffmann
+ */
+void read_ctlmap(
+  int argc,
+  char *argv[],
+  ctlmap_t * map);
+
+/**
+ * @brief Map one record of a memory-mappable binary file.
+ *
+ * Checks the magic string and the dimensions in the file header,
+ * looks up the record in the index, and maps it with `mmap`.
+ *
+ * @param in     Pointer to an open binary input file stream.
+ * @param magic  Expected magic string (4 characters).
+ * @param dim    Expected dimensions stored in the header.
+ * @param ndim   Number of dimensions.
+ * @param rec    Record index.
+ * @param n      Output: number of data points of the record.
+ * @param map    Output: start of the mapped region (for `munmap`).
+ * @param len    Output: size of the mapped region [bytes].
+ *
+ * @return Pointer to the first value of the record.
+ *
+ * @see write_map_header, read_atm_map, read_obs_map
+ *
+ * @author Lars Hoffmann
+ */
+double *read_map_rec(
+  FILE * in,
+  const char *magic,
+  const int *dim,
+  const int ndim,
+  const size_t rec,
+  size_t * n,
+  void **map,
+  size_t * len);
+
+/**
+ * @brief Read a numerical matrix from file.
+ *
+ * Loads a matrix written by write_matrix() into a GSL matrix. The
+ * file format is selected by `ctl->matrixfmt`.
+ *
+ * @param[in]  dirname   Directory path containing the matrix file (may be NULL).
+ * @param[in]  filename  Name of the matrix file to read.
+ * @param[in]  ctl       Control structure providing the file format.
+ * @param[out] matrix    Pointer to the GSL matrix to be filled with values.
+ *
+ * @details
+ * - ASCII format (`ctl->matrixfmt == 1`), read by read_matrix_asc().
+ * - Binary format (`ctl->matrixfmt == 2`), read by read_matrix_bin().
+ *
+ * @see write_matrix, read_matrix_asc, read_matrix_bin
+ *
+ * @warning
+ * - Aborts if the file cannot be opened or the format is unknown.
+ * - The matrix must be allocated with the dimensions of the stored data.
+ *
+ * @author Lars Hoffmann
+ */
+void read_matrix(
+  const char *dirname,
+  const char *filename,
+  const ctl_t * ctl,
+  gsl_matrix * matrix);
+
 /**
  * @brief Read a numerical matrix from an ASCII file.
  *
@@ -3168,12 +4532,10 @@ void read_ctl(
  * sparse or indexed entries in tabular format.  
  * Each valid line is parsed for row and column indices and the corresponding value.
  *
- * @param[in]  dirname   Directory path containing the matrix file (may be NULL).
- * @param[in]  filename  Name of the matrix file to read.
- * @param[out] matrix    Pointer to the GSL matrix to be filled with values.
+ * @param[in]  in      Pointer to an open input file stream.
+ * @param[out] matrix  Pointer to the GSL matrix to be filled with values.
  *
  * @details
- * - Opens the specified file and scans it line by line.
  * - Initializes the matrix to zero before filling.
  * - Each line is expected to contain at least 13 formatted fields, where:
  *   - The first integer gives the row index,
@@ -3183,18 +4545,37 @@ void read_ctl(
  *   in the GSL matrix using @c gsl_matrix_set().
  * - Non-matching lines are ignored.
  *
- * @see gsl_matrix, read_ctl, read_atm
+ * @see read_matrix, write_matrix_asc
  *
  * @warning
- * - Aborts if the file cannot be opened.
  * - Expects 0-based integer indices consistent with matrix dimensions.
  * - Lines not matching the expected 13-field format are skipped silently.
  *
  * @author Lars Hoffmann
  */
-void read_matrix(
-  const char *dirname,
-  const char *filename,
+void read_matrix_asc(
+  FILE * in,
+  gsl_matrix * matrix);
+
+/**
+ * @brief Read a numerical matrix from a binary file.
+ *
+ * Reads a file written by write_matrix_bin(). The header is checked
+ * against the matrix dimensions, the row and column descriptor
+ * tables are skipped, and the raw data block is read row by row.
+ *
+ * @param[in]  in      Pointer to an open binary input file stream.
+ * @param[out] matrix  Pointer to the GSL matrix to be filled with values.
+ *
+ * @see read_matrix, write_matrix_bin
+ *
+ * @warning Execution is terminated via `ERRMSG` if the magic string or
+ *          the matrix dimensions do not match, or if the file is truncated.
+ *
+ * @author Lars Hoffmann
+ */
+void read_matrix_bin(
+  FILE * in,
   gsl_matrix * matrix);
 
 /**
@@ -3258,12 +4639,8 @@ void read_obs(
  *                  of spectral channels (`nd`).
  * @param[out] obs  Observation structure where parsed data will be stored.
  *
- * @note This is a C function and assumes that the @p obs structure has been
- *       preallocated with sufficient space for all records and spectral
- *       channels. No memory allocation is performed inside this routine.
- *
- * @warning The function terminates with an error message if the number of
- *          entries exceeds the predefined limit `NR`.
+ * @note Memory for the ray paths is allocated on the fly
+ *       (@ref alloc_obs).
  *
  * @see read_obs(), read_obs_bin(), ctl_t, obs_t
  *
@@ -3274,6 +4651,42 @@ void read_obs_asc(
   const ctl_t * ctl,
   obs_t * obs);
 
+/**
+ * @brief Read a chunk of observation data from an ASCII file.
+ *
+ * Reads up to @p nmax ray paths from the current position of the input
+ * stream, using the same format as read_obs_asc(). If a field of view
+ * is applied (@ref ctl_t::fov), the chunk is extended so that all rays
+ * with the same time (one FOV scan) stay together. The stream is left
+ * at the first ray of the next chunk.
+ *
+ * The first line of the next chunk is pushed back with a single
+ * fseek() per chunk. Splitting a file into chunks therefore requires
+ * a seekable stream, whereas reading all rays at once (as done by
+ * read_obs_asc()) also works on pipes.
+ *
+ * @param in    Pointer to an open input file stream.
+ * @param ctl   Pointer to control structure.
+ * @param obs   Output observation data (reallocated as needed).
+ * @param nmax  Maximum number of ray paths per chunk.
+ * @param nline Line counter of the input file (in/out; initialize to
+ *              zero before the first chunk), used in error messages.
+ *
+ * @return Number of ray paths read (0 at end of file).
+ *
+ * @warning Aborts via `ERRMSG()` if the line cannot be pushed back.
+ *
+ * @see read_obs_asc, write_obs_asc_chunk
+ *
+ * @author Lars Hoffmann
+ */
+int read_obs_asc_chunk(
+  FILE * in,
+  const ctl_t * ctl,
+  obs_t * obs,
+  const int nmax,
+  int *nline);
+
 /**
  * @brief Read binary-formatted observation data from an open file stream.
  *
@@ -3303,8 +4716,8 @@ void read_obs_asc(
  *       for the data being read.
  *
  * @warning The function terminates with an error message if the binary header
- *          does not match the expected channel count, if more data than allowed
- *          by `NR` is encountered, or if any read operation fails.
+ *          does not match the expected channel count or if any read operation
+ *          fails.
  *
  * @see read_obs(), read_obs_asc(), ctl_t, obs_t
  *
@@ -3315,6 +4728,28 @@ void read_obs_bin(
   const ctl_t * ctl,
   obs_t * obs);
 
+/**
+ * @brief Map observation data from a memory-mappable binary file.
+ *
+ * Maps one record of a file written by write_obs_map() into memory
+ * and sets the arrays of @p obs to views into the mapped pages
+ * (see read_atm_map()).
+ *
+ * @param in   Pointer to an open binary input file stream.
+ * @param ctl  Pointer to control structure (checked against the header).
+ * @param rec  Record index.
+ * @param obs  Observation data; previous contents are released.
+ *
+ * @see write_obs_map, read_map_rec
+ *
+ * @author Lars Hoffmann
+ */
+void read_obs_map(
+  FILE * in,
+  const ctl_t * ctl,
+  const size_t rec,
+  obs_t * obs);
+
 /**
  * @brief Read and spectrally convolve an RFM output spectrum.
  *
@@ -3361,6 +4796,69 @@ double read_obs_rfm(
   const double *f,
   const int n);
 
+/**
+ * @brief Close a profile container opened for reading.
+ *
+ * Output containers created with write_prf_create() must be closed
+ * with write_prf_close() instead.
+ *
+ * @param prf  Pointer to a container opened with read_prf_open().
+ *
+ * @return 0 on success, -1 on invalid handle.
+ *
+ * @see read_prf_open, write_prf_close
+ *
+ * @author Lars Hoffmann
+ */
+int read_prf_close(
+  prf_t * prf);
+
+/**
+ * @brief Open a profile container for reading.
+ *
+ * Reads the file header, checks it against the control parameters
+ * (number of emitters, spectral windows, cloud and surface parameters,
+ * and channels), and loads the record index.
+ *
+ * @param filename  Path to the profile container.
+ * @param ctl       Pointer to control structure.
+ * @param prf       Output parameter: populated container handle.
+ *
+ * @warning Aborts via `ERRMSG()` if the file cannot be opened or the
+ *          header does not match.
+ *
+ * @see prf_t, read_prf_single, read_prf_close
+ *
+ * @author Lars Hoffmann
+ */
+void read_prf_open(
+  const char *filename,
+  const ctl_t * ctl,
+  prf_t * prf);
+
+/**
+ * @brief Read one record from a profile container.
+ *
+ * Seeks to the record via the index and reads the atmospheric data
+ * and the observation data with read_atm_bin() and read_obs_bin().
+ * File access is serialized, so that the function can be called from
+ * several OpenMP threads sharing the same container.
+ *
+ * @param prf  Pointer to an open profile container.
+ * @param ctl  Pointer to control structure.
+ * @param rec  Record index (0 ... prf->n - 1).
+ * @param atm  Output atmospheric data.
+ * @param obs  Output observation data.
+ *
+ * @author Lars Hoffmann
+ */
+void read_prf_single(
+  prf_t * prf,
+  const ctl_t * ctl,
+  const size_t rec,
+  atm_t * atm,
+  obs_t * obs);
+
 /**
  * @brief Read retrieval configuration and error parameters.
  *
@@ -3714,8 +5212,10 @@ int read_tbl_gas_single(
  * @return The variable value converted to `double`.
  *
  * @details
- * - The routine first attempts to open the control file provided as the first
- *   command-line argument (`argv[1]`), unless it starts with '-'.
+ * - On the first call, the control file provided as the first command-line
+ *   argument (`argv[1]`, unless it starts with '-') and the command-line
+ *   arguments are parsed into a hash map (@ref read_ctlmap). Later calls
+ *   with the same `argc` and `argv` only query the map.
  * - Variable names may appear as either:
  *   - `VAR` (scalar)
  *   - `VAR[index]` (explicit array index)
@@ -3735,7 +5235,7 @@ int read_tbl_gas_single(
  *   - Otherwise, the routine aborts with an error.
  * - The variable value is printed to the log at verbosity level 1.
  *
- * @see read_ctl, LOG, ERRMSG
+ * @see read_ctl, read_ctlmap, LOG, ERRMSG
  *
  * @warning
  * - Aborts if the control file cannot be opened (unless skipped with '-').
@@ -3758,6 +5258,27 @@ double scan_ctl(
   const char *defvalue,
   char *value);
 
+/**
+ * @brief Read a floating-point value from a whitespace-separated line.
+ *
+ * Skips spaces and tabs at `*s`, converts the following token with
+ * `strtod()`, and advances `*s` to the end of the token. Unlike
+ * `strtok()`, the line buffer is not modified, so that the tokenizer
+ * is reentrant.
+ *
+ * @param[in,out] s Pointer to the current position in the line buffer.
+ * @param[out] x Parsed value.
+ * @return 1 if the token was read, 0 if it is not a number,
+ *         and -1 if the end of the line has been reached.
+ *
+ * @see FTOK, read_atm_asc, read_obs_asc_chunk
+ *
+ * @author Lars Hoffmann
+ */
+int scan_tok(
+  char **s,
+  double *x);
+
 /**
  * @brief Construct the a priori covariance matrix \f$\mathbf{S_a}\f$ for retrieval parameters.
  *
@@ -3791,6 +5312,15 @@ double scan_ctl(
  *     state vector locations,
  *   - \f$L_h\f$ and \f$L_v\f$ are horizontal and vertical correlation lengths
  *     for the parameter type.
+ * - Correlation lengths and Cartesian coordinates are determined once per
+ *   state vector element. Since the elements of each quantity are
+ *   contiguous in the state vector, only the diagonal blocks are visited,
+ *   in parallel by means of OpenMP.
+ * - Correlations below `ret->err_rho_min` are set to zero. Such a
+ *   truncated exponential correlation matrix is not guaranteed to be
+ *   positive definite; each truncated block is therefore checked by a
+ *   trial Cholesky decomposition, and the function aborts with an
+ *   error message asking to decrease `ERR_RHO_MIN` if the check fails.
  *
  * @see atm2x, geo2cart, DIST, ret_t, ctl_t
  *
@@ -4031,7 +5561,8 @@ void time2jsec(
  *
  * @note
  * - The timing precision and resolution depend on the OpenMP runtime.
- * - Intended for coarse profiling and diagnostic output; not thread-safe.
+ * - Intended for coarse profiling and diagnostic output. The timer stack
+ *   is thread-private, so each OpenMP thread has its own nesting levels.
  * - Lines reported in log messages indicate the start–stop interval.
  *
  * @warning
@@ -4047,6 +5578,126 @@ void timer(
   int line,
   int mode);
 
+/**
+ * @brief Check whether warm-start data can be used for a retrieval.
+ *
+ * Compares the atmospheric grid and the observation geometry of a
+ * previous retrieval with those of the next one.
+ *
+ * @param[in]  ret      Retrieval parameters (tolerances `warm_dh`, `warm_dz`).
+ * @param[in]  ctl      Control parameters.
+ * @param[in]  warm     Warm-start data of the previous retrieval.
+ * @param[in]  atm      A priori atmospheric state of the next retrieval.
+ * @param[in]  obs      Measured observation data of the next retrieval.
+ * @param[out] use_atm  Set to 1 if the retrieved state can be used as
+ *                      initial guess.
+ * @param[out] use_k    Set to 1 if the kernel matrix can be used as
+ *                      initial kernel.
+ *
+ * @details
+ * - The state is reused if both profiles have the same altitude grid and
+ *   corresponding grid points are less than `ret->warm_dh` apart.
+ * - The kernel is reused in addition if the observations have the same
+ *   number of ray paths and the same pattern of valid radiances, and if
+ *   observer and view point altitudes differ by less than `ret->warm_dz`
+ *   and their horizontal positions by less than `ret->warm_dh`.
+ *
+ * @see optimal_estimation, warm_t
+ *
+ * @author Lars Hoffmann
+ */
+void warm_check(
+  const ret_t * ret,
+  const ctl_t * ctl,
+  const warm_t * warm,
+  const atm_t * atm,
+  const obs_t * obs,
+  int *use_atm,
+  int *use_k);
+
+/**
+ * @brief Wait for the asynchronous writer to finish all output jobs.
+ *
+ * Blocks until all jobs submitted with @ref write_atm_async,
+ * @ref write_obs_async, or @ref write_matrix_async have been written,
+ * and stops the output thread. Must be called before the program exits
+ * and must not be called while other threads are submitting jobs.
+ * If a job has failed, the error is raised here via @ref ERRMSG.
+ *
+ * @see write_async_submit
+ *
+ * @author Lars Hoffmann
+ */
+void write_async_flush(
+  void);
+
+/**
+ * @brief Write the data of an output job and free the job.
+ *
+ * @param[in,out] job Output job (freed on return).
+ *
+ * @see write_async_thread
+ *
+ * @author Lars Hoffmann
+ */
+void write_async_run(
+  wrt_job_t * job);
+
+/**
+ * @brief Add an output job to the queue of the asynchronous writer.
+ *
+ * Starts the output thread on first use, with a queue length of
+ * `ctl->write_async` jobs. If the queue is full, the caller waits until
+ * a job has been taken by the writer, which bounds the memory held by
+ * pending output. If an earlier job has failed, the error is raised
+ * here via @ref ERRMSG on the calling thread.
+ *
+ * @param[in] ctl Control parameters.
+ * @param[in] job Output job (ownership is passed to the writer).
+ *
+ * @see write_async_flush, write_async_thread
+ *
+ * @author Lars Hoffmann
+ */
+void write_async_submit(
+  const ctl_t * ctl,
+  wrt_job_t * job);
+
+/**
+ * @brief Main loop of the output thread.
+ *
+ * Takes jobs from the queue in submission order and writes them with
+ * @ref write_async_try. Log messages of each job are buffered and
+ * printed as a block once the job is done. Failed jobs do not exit the
+ * program from the output thread; the first failure is recorded and
+ * raised by @ref write_async_submit or @ref write_async_flush.
+ *
+ * @param[in] arg Unused.
+ * @return NULL.
+ *
+ * @author Lars Hoffmann
+ */
+void *write_async_thread(
+  void *arg);
+
+/**
+ * @brief Run an output job and catch errors.
+ *
+ * Calls @ref write_async_run with @ref err_jmp set, so that an
+ * @ref ERRMSG in the output routines returns here instead of calling
+ * `exit()` from the output thread. The name of the first failed file
+ * is recorded for the main thread.
+ *
+ * @param[in,out] job Output job (freed on success).
+ * @return 0 on success, 1 on failure.
+ *
+ * @see write_async_thread
+ *
+ * @author Lars Hoffmann
+ */
+int write_async_try(
+  wrt_job_t * job);
+
 /**
  * @brief Write atmospheric data to a file.
  *
@@ -4153,6 +5804,51 @@ void write_atm_asc(
   const ctl_t * ctl,
   const atm_t * atm);
 
+/**
+ * @brief Write atmospheric data in the background.
+ *
+ * Same as @ref write_atm, but if `ctl->write_async > 0`, a copy of the
+ * data is handed to the output thread and the function returns
+ * immediately. Call @ref write_async_flush before the program exits.
+ *
+ * @param[in] dirname  Directory name (may be NULL).
+ * @param[in] filename Output file name.
+ * @param[in] ctl      Control parameters.
+ * @param[in] atm      Atmospheric data.
+ *
+ * @see write_atm, write_async_submit
+ *
+ * @author Lars Hoffmann
+ */
+void write_atm_async(
+  const char *dirname,
+  const char *filename,
+  const ctl_t * ctl,
+  const atm_t * atm);
+
+/**
+ * @brief Write atmospheric data in the background and release them.
+ *
+ * Same as @ref write_atm_async, but takes ownership of @p atm, which
+ * must have been allocated on the heap. The data are handed to the
+ * output thread without a copy (or written synchronously) and are
+ * freed with @ref free_atm and `free()` once they have been written.
+ *
+ * @param[in] dirname  Directory name (may be NULL).
+ * @param[in] filename Output file name.
+ * @param[in] ctl      Control parameters.
+ * @param[in] atm      Atmospheric data (ownership is passed on).
+ *
+ * @see write_atm_async, write_async_submit
+ *
+ * @author Lars Hoffmann
+ */
+void write_atm_async_own(
+  const char *dirname,
+  const char *filename,
+  const ctl_t * ctl,
+  atm_t * atm);
+
 /**
  * @brief Write atmospheric data to a binary file.
  *
@@ -4212,6 +5908,37 @@ void write_atm_bin(
   const ctl_t * ctl,
   const atm_t * atm);
 
+/**
+ * @brief Write atmospheric data to a memory-mappable binary file.
+ *
+ * The file structure is as follows:
+ *   1. **Magic identifier** `"ATM2"` (4 bytes)
+ *   2. **Header integers**: `ctl->ng`, `ctl->nw`, `ctl->ncl`, `ctl->nsf`
+ *   3. **Number of records** (`size_t`)
+ *   4. **Index** with offset, number of data points, and size in bytes
+ *      of each record (3 × `size_t` per record)
+ *   5. **Records**, each starting at a multiple of @ref MAPALIGN bytes:
+ *        - Time, altitude, longitude, latitude, pressure, temperature
+ *        - Volume mixing ratios (`ctl->ng × np`)
+ *        - Extinction coefficients (`ctl->nw × np`)
+ *        - Cloud layer height, depth, and extinction (`ctl->ncl`)
+ *        - Surface temperature and emissivity (`ctl->nsf`)
+ *
+ * @param out   Pointer to an open binary output file stream.
+ * @param ctl   Pointer to control structure.
+ * @param atm   Array of @p nrec atmospheric data sets.
+ * @param nrec  Number of records.
+ *
+ * @see read_atm_map, write_map_header
+ *
+ * @author Lars Hoffmann
+ */
+void write_atm_map(
+  FILE * out,
+  const ctl_t * ctl,
+  const atm_t * atm,
+  const int nrec);
+
 /**
  * @brief Write atmospheric profile in RFM-compatible format.
  *
@@ -4268,6 +5995,36 @@ void write_atm_rfm(
   const ctl_t * ctl,
   const atm_t * atm);
 
+/**
+ * @brief Write the header and index of a memory-mappable binary file.
+ *
+ * Computes the record offsets, aligned to @ref MAPALIGN bytes, and
+ * writes the magic string, the dimensions, the number of records, and
+ * the record index.
+ *
+ * @param out    Pointer to an open binary output file stream.
+ * @param magic  Magic string (4 characters).
+ * @param dim    Dimensions stored in the header.
+ * @param ndim   Number of dimensions.
+ * @param nrec   Number of records.
+ * @param n      Number of data points of each record.
+ * @param len    Size of each record [bytes].
+ * @param off    Output: file offset of each record.
+ *
+ * @see read_map_rec, write_atm_map, write_obs_map
+ *
+ * @author Lars Hoffmann
+ */
+void write_map_header(
+  FILE * out,
+  const char *magic,
+  const int *dim,
+  const int ndim,
+  const size_t nrec,
+  const size_t * n,
+  const size_t * len,
+  size_t * off);
+
 /**
  * @brief Write a fully annotated matrix (e.g., Jacobian or gain matrix) to file.
  *
@@ -4299,8 +6056,10 @@ void write_atm_rfm(
  *     - Quantity name (e.g., TEMPERATURE, H2O)
  *     - Time, altitude, longitude, latitude of the profile point
  * - The header clearly documents all output columns for traceability.
+ * - With `ctl->matrixfmt == 2`, the matrix is written in binary format
+ *   by write_matrix_bin() instead; `sort` is ignored in this case.
  *
- * @see read_matrix, kernel, atm2x, obs2y, idx2name
+ * @see read_matrix, write_matrix_asc, write_matrix_bin, kernel, atm2x, obs2y, idx2name
  *
  * @note
  * - The function respects `ctl->write_matrix` — output is skipped if disabled.
@@ -4310,7 +6069,7 @@ void write_atm_rfm(
  *
  * @warning
  * - Large matrices may produce very large output files.
- * - Memory allocation is performed for temporary indexing arrays; ensure sufficient resources for large N, M.
+ * - Memory allocation is performed for temporary indexing arrays sized by the matrix dimensions.
  * - The function overwrites existing files without confirmation.
  *
  * @author Lars Hoffmann
@@ -4326,6 +6085,121 @@ void write_matrix(
   const char *colspace,
   const char *sort);
 
+/**
+ * @brief Write an annotated matrix in ASCII format.
+ *
+ * Writes one matrix element per line together with the row and
+ * column metadata, as described for write_matrix().
+ *
+ * @param[in] out       Pointer to an open output file stream.
+ * @param[in] ctl       Pointer to control structure.
+ * @param[in] matrix    Pointer to GSL matrix to write.
+ * @param[in] atm       Pointer to atmospheric data structure.
+ * @param[in] obs       Pointer to observation data structure.
+ * @param[in] rowspace  Row labeling: `"y"` = measurement space, otherwise state space.
+ * @param[in] colspace  Column labeling: `"y"` = measurement space, otherwise state space.
+ * @param[in] sort      Writing order: `"r"` = row-major, otherwise column-major.
+ *
+ * @see write_matrix, read_matrix_asc
+ *
+ * @author Lars Hoffmann
+ */
+void write_matrix_asc(
+  FILE * out,
+  const ctl_t * ctl,
+  const gsl_matrix * matrix,
+  const atm_t * atm,
+  const obs_t * obs,
+  const char *rowspace,
+  const char *colspace,
+  const char *sort);
+
+/**
+ * @brief Write a matrix in the background.
+ *
+ * Same as @ref write_matrix, but if `ctl->write_async > 0`, copies of
+ * the matrix and of the atmospheric and observation data are handed to
+ * the output thread and the function returns immediately.
+ *
+ * @see write_matrix, write_async_submit, write_async_flush
+ *
+ * @author Lars Hoffmann
+ */
+void write_matrix_async(
+  const char *dirname,
+  const char *filename,
+  const ctl_t * ctl,
+  const gsl_matrix * matrix,
+  const atm_t * atm,
+  const obs_t * obs,
+  const char *rowspace,
+  const char *colspace,
+  const char *sort);
+
+/**
+ * @brief Write a matrix in the background and release it.
+ *
+ * Same as @ref write_matrix_async, but takes ownership of @p matrix.
+ * The matrix is handed to the output thread without a copy (or written
+ * synchronously) and is freed with `gsl_matrix_free()` once it has been
+ * written, so large kernel or gain matrices are not held twice.
+ *
+ * @see write_matrix_async, write_async_submit, write_async_flush
+ *
+ * @author Lars Hoffmann
+ */
+void write_matrix_async_own(
+  const char *dirname,
+  const char *filename,
+  const ctl_t * ctl,
+  gsl_matrix * matrix,
+  const atm_t * atm,
+  const obs_t * obs,
+  const char *rowspace,
+  const char *colspace,
+  const char *sort);
+
+/**
+ * @brief Write an annotated matrix in binary format.
+ *
+ * The binary file structure written is as follows:
+ *   1. **Magic identifier** `"MAT1"` (4 bytes)
+ *   2. **Row and column space** (`'y'` or `'x'`, 1 byte each)
+ *   3. **Number of rows and columns** (2 × `size_t`)
+ *   4. **Row descriptor table**, followed by the **column descriptor table**,
+ *      each consisting of arrays with one entry per row or column:
+ *        - Channel index (measurement space) or quantity index
+ *          (state space) as `int`
+ *        - Time, altitude, longitude, and latitude as `double`
+ *          (view point coordinates in measurement space)
+ *   5. **Data block** with all matrix elements as `double`
+ *      in row-major order.
+ *
+ * @param[in] out       Pointer to an open binary output file stream.
+ * @param[in] ctl       Pointer to control structure.
+ * @param[in] matrix    Pointer to GSL matrix to write.
+ * @param[in] atm       Pointer to atmospheric data structure.
+ * @param[in] obs       Pointer to observation data structure.
+ * @param[in] rowspace  Row labeling: `"y"` = measurement space, otherwise state space.
+ * @param[in] colspace  Column labeling: `"y"` = measurement space, otherwise state space.
+ *
+ * @warning The binary structure must remain consistent with
+ *          read_matrix_bin(); modifying either implementation requires
+ *          updating the other accordingly.
+ *
+ * @see write_matrix, read_matrix_bin
+ *
+ * @author Lars Hoffmann
+ */
+void write_matrix_bin(
+  FILE * out,
+  const ctl_t * ctl,
+  const gsl_matrix * matrix,
+  const atm_t * atm,
+  const obs_t * obs,
+  const char *rowspace,
+  const char *colspace);
+
 /**
  * @brief Write observation data to an output file in ASCII or binary format.
  *
@@ -4403,6 +6277,54 @@ void write_obs_asc(
   const ctl_t * ctl,
   const obs_t * obs);
 
+/**
+ * @brief Write a chunk of observation data to an ASCII file.
+ *
+ * Writes the ray paths of @p obs in the format of write_obs_asc(), so
+ * that a file can be written incrementally, chunk by chunk. The output
+ * of all chunks is identical to a single call of write_obs_asc().
+ *
+ * @param out     Pointer to an open output file stream.
+ * @param ctl     Pointer to control structure.
+ * @param obs     Observation data of the current chunk.
+ * @param header  Write the column header (1=yes, 0=no).
+ * @param t0      Time of the last ray path of the previous chunk
+ *                (NAN for the first chunk), used for the blank lines
+ *                separating different times.
+ *
+ * @see write_obs_asc, read_obs_asc_chunk
+ *
+ * @author Lars Hoffmann
+ */
+void write_obs_asc_chunk(
+  FILE * out,
+  const ctl_t * ctl,
+  const obs_t * obs,
+  const int header,
+  const double t0);
+
+/**
+ * @brief Write observation data in the background.
+ *
+ * Same as @ref write_obs, but if `ctl->write_async > 0`, a copy of the
+ * data is handed to the output thread and the function returns
+ * immediately.
+ *
+ * @param[in] dirname  Directory name (may be NULL).
+ * @param[in] filename Output file name.
+ * @param[in] ctl      Control parameters.
+ * @param[in] obs      Observation data.
+ *
+ * @see write_obs, write_async_submit, write_async_flush
+ *
+ * @author Lars Hoffmann
+ */
+void write_obs_async(
+  const char *dirname,
+  const char *filename,
+  const ctl_t * ctl,
+  const obs_t * obs);
+
 /**
  * @brief Write observation data in binary format to an output file stream.
  *
@@ -4439,6 +6361,92 @@ void write_obs_bin(
   const ctl_t * ctl,
   const obs_t * obs);
 
+/**
+ * @brief Write observation data to a memory-mappable binary file.
+ *
+ * Uses the layout of write_atm_map() with magic string `"OBS2"`, the
+ * number of channels `ctl->nd` as the only header integer, and records
+ * holding time, observer, view point, and tangent point coordinates,
+ * followed by radiances and transmittances (`ctl->nd × nr` each).
+ *
+ * @param out   Pointer to an open binary output file stream.
+ * @param ctl   Pointer to control structure.
+ * @param obs   Array of @p nrec observation data sets.
+ * @param nrec  Number of records.
+ *
+ * @see read_obs_map, write_map_header
+ *
+ * @author Lars Hoffmann
+ */
+void write_obs_map(
+  FILE * out,
+  const ctl_t * ctl,
+  const obs_t * obs,
+  const int nrec);
+
+/**
+ * @brief Close a profile container opened for writing.
+ *
+ * Checks that all records have been written, stores the record index,
+ * and closes the file.
+ *
+ * @param prf  Pointer to a container created with write_prf_create().
+ *
+ * @warning Aborts via `ERRMSG()` if the handle is invalid, a record is
+ *          missing, or the index cannot be written.
+ *
+ * @see write_prf_create, write_prf_single, read_prf_close
+ *
+ * @author Lars Hoffmann
+ */
+void write_prf_close(
+  prf_t * prf);
+
+/**
+ * @brief Create a profile container for writing.
+ *
+ * Writes the file header and an empty index for @p n records. Records
+ * are added with write_prf_single() in any order; the index is written
+ * by write_prf_close().
+ *
+ * @param filename  Path to the profile container.
+ * @param ctl       Pointer to control structure.
+ * @param n         Number of records.
+ * @param prf       Output parameter: populated container handle.
+ *
+ * @see prf_t, write_prf_single, write_prf_close
+ *
+ * @author Lars Hoffmann
+ */
+void write_prf_create(
+  const char *filename,
+  const ctl_t * ctl,
+  const size_t n,
+  prf_t * prf);
+
+/**
+ * @brief Write one record to a profile container.
+ *
+ * Appends the atmospheric data and the observation data of record
+ * @p rec with write_atm_bin() and write_obs_bin() and stores its
+ * offset in the index. File access is serialized, so that the function
+ * can be called from several OpenMP threads sharing the same container.
+ *
+ * @param prf  Pointer to a profile container created with write_prf_create().
+ * @param ctl  Pointer to control structure.
+ * @param rec  Record index (0 ... prf->n - 1).
+ * @param atm  Atmospheric data.
+ * @param obs  Observation data.
+ *
+ * @author Lars Hoffmann
+ */
+void write_prf_single(
+  prf_t * prf,
+  const ctl_t * ctl,
+  const size_t rec,
+  const atm_t * atm,
+  const obs_t * obs);
+
 /**
  * @brief Write tabulated shape function data to a text file.
  *
@@ -4482,7 +6490,7 @@ void write_shape(
 /**
  * @brief Write retrieval standard deviation profiles to disk.
  *
- * Extracts the diagonal elements of a covariance matrix (a priori,
+ * Takes the diagonal elements of a covariance matrix (a priori,
  * posterior, or error covariance) to obtain the standard deviations
  * of retrieved quantities and writes them as an atmospheric profile file.
  *
@@ -4492,13 +6500,15 @@ void write_shape(
  *                       providing the working directory for output files.
  * @param[in]  ctl       Global control structure (`ctl_t`) defining retrieval setup and quantities.
  * @param[in]  atm       Reference atmospheric state (`atm_t`) for spatial/geometric metadata.
- * @param[in]  s         Covariance matrix (`gsl_matrix`, n×n) from which standard deviations
- *                       are derived (typically posterior covariance \f$\mathbf{S}\f$).
+ * @param[in]  var       Diagonal of the covariance matrix (`gsl_vector`, length n)
+ *                       from which standard deviations are derived (typically
+ *                       a view of the diagonal of the posterior covariance
+ *                       \f$\mathbf{S}\f$, or variances computed directly).
  *
  * @details
  * This function performs the following operations:
- * 1. Extracts the standard deviation vector \f$\sigma_i = \sqrt{S_{ii}}\f$
- *    from the diagonal of the covariance matrix \f$\mathbf{S}\f$.
+ * 1. Computes the standard deviation vector \f$\sigma_i = \sqrt{S_{ii}}\f$
+ *    from the variances \f$S_{ii}\f$.
  * 2. Copies the reference atmospheric structure (`atm`) into an auxiliary
  *    structure (`atm_aux`) to preserve coordinate and geometric metadata.
  * 3. Converts the standard deviation vector into the atmospheric representation
@@ -4519,7 +6529,7 @@ void write_shape(
  * - Only diagonal uncertainties are written; correlations are not stored.
  *
  * @warning
- * - The covariance matrix `s` must be symmetric and positive-definite.
+ * - The variances `var` must be non-negative.
  * - The state vector mapping (`x2atm`) must correspond to the matrix ordering.
  *
  * @author Lars Hoffmann
@@ -4529,7 +6539,7 @@ void write_stddev(
   const ret_t * ret,
   const ctl_t * ctl,
   const atm_t * atm,
-  const gsl_matrix * s);
+  const gsl_vector * var);
 
 /**
  * @brief Write all emissivity lookup tables in the format specified by the control structure.
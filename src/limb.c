@@ -48,12 +48,12 @@ int main(
   /* Create measurement geometry... */
   for (double t = t0; t <= t1; t += dt)
     for (double z = z0; z <= z1; z += dz) {
+      alloc_obs(&ctl, &obs, obs.nr + 1);
       obs.time[obs.nr] = t;
       obs.obsz[obs.nr] = obsz;
       obs.vpz[obs.nr] = z;
       obs.vplat[obs.nr] = 180 / M_PI * acos((RE + z) / (RE + obsz));
-      if ((++obs.nr) >= NR)
-	ERRMSG("Too many rays!");
+      obs.nr++;
     }
 
   /* Write observation data... */
@@ -0,0 +1,134 @@
+/*
+  This file is part of JURASSIC.
+
+  JURASSIC is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  JURASSIC is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with JURASSIC. If not, see <http://www.gnu.org/licenses/>.
+
+  Copyright (C) 2003-2025 Forschungszentrum Juelich GmbH
+*/
+
+/*!
+  \file
+  Benchmark the linear algebra of the retrieval.
+*/
+
+#include "jurassic.h"
+
+/* ------------------------------------------------------------
+   Main...
+   ------------------------------------------------------------ */
+
+int main(
+  int argc,
+  char *argv[]) {
+
+  /* Check arguments... */
+  if (argc < 4)
+    ERRMSG("Give parameters: <n_min> <n_max> <n_step>");
+
+  /* Get state vector sizes... */
+  const int n_min = atoi(argv[1]);
+  const int n_max = atoi(argv[2]);
+  const int n_step = atoi(argv[3]);
+  if (n_min <= 0 || n_max < n_min || n_step <= 0)
+    ERRMSG("Check state vector sizes!");
+
+  /* Initialize random number generator... */
+  gsl_rng_env_setup();
+  gsl_rng *rng = gsl_rng_alloc(gsl_rng_default);
+
+  /* Write header... */
+  printf("# $1 = size of state and measurement vector\n"
+	 "# $2 = time for K^T S_eps^-1 K (matrix_product) [s]\n"
+	 "# $3 = time for matrix inversion (matrix_invert) [s]\n"
+	 "# $4 = time for Cholesky solve (matrix_solve) [s]\n"
+	 "# $5 = relative residual of Cholesky solve\n"
+	 "# $6 = time for inverse Cholesky factor (matrix_inv_chol) [s]\n\n");
+
+  /* Loop over sizes... */
+  for (int n = n_min; n <= n_max; n += n_step) {
+
+    /* Allocate... */
+    gsl_matrix *k = gsl_matrix_alloc((size_t) n, (size_t) n);
+    gsl_matrix *s_a = gsl_matrix_alloc((size_t) n, (size_t) n);
+    gsl_matrix *a = gsl_matrix_alloc((size_t) n, (size_t) n);
+    gsl_matrix *cov = gsl_matrix_alloc((size_t) n, (size_t) n);
+    gsl_vector *sig_eps_inv = gsl_vector_alloc((size_t) n);
+    gsl_vector *b = gsl_vector_alloc((size_t) n);
+    gsl_vector *x = gsl_vector_alloc((size_t) n);
+    gsl_vector *r = gsl_vector_alloc((size_t) n);
+
+    /* Set up kernel matrix and measurement errors... */
+    for (size_t i = 0; i < (size_t) n; i++) {
+      gsl_vector_set(sig_eps_inv, i, 1 / gsl_ran_flat(rng, 0.5, 2));
+      gsl_vector_set(b, i, gsl_ran_gaussian(rng, 1));
+      for (size_t j = 0; j < (size_t) n; j++)
+	gsl_matrix_set(k, i, j, gsl_ran_gaussian(rng, 1));
+    }
+
+    /* Set up a priori covariance (exponential correlation)... */
+    for (size_t i = 0; i < (size_t) n; i++)
+      for (size_t j = 0; j < (size_t) n; j++)
+	gsl_matrix_set(s_a, i, j,
+		       exp(-fabs((double) i - (double) j) / 10.));
+
+    /* Compute K^T S_eps^-1 K... */
+    double t0 = omp_get_wtime();
+    matrix_product(k, sig_eps_inv, 1, cov);
+    const double t_product = omp_get_wtime() - t0;
+
+    /* Invert a priori covariance... */
+    t0 = omp_get_wtime();
+    matrix_invert(s_a);
+    const double t_invert = omp_get_wtime() - t0;
+
+    /* Solve A x = b with A = S_a^-1 + K^T S_eps^-1 K... */
+    gsl_matrix_memcpy(a, s_a);
+    gsl_matrix_add(a, cov);
+    t0 = omp_get_wtime();
+    matrix_solve(a, b, x);
+    const double t_solve = omp_get_wtime() - t0;
+
+    /* Get residual... */
+    gsl_matrix_memcpy(a, s_a);
+    gsl_matrix_add(a, cov);
+    gsl_vector_memcpy(r, b);
+    gsl_blas_dgemv(CblasNoTrans, 1.0, a, x, -1.0, r);
+    const double res = gsl_blas_dnrm2(r) / gsl_blas_dnrm2(b);
+
+    /* Get inverse Cholesky factor of A... */
+    t0 = omp_get_wtime();
+    matrix_inv_chol(a);
+    const double t_inv_chol = omp_get_wtime() - t0;
+
+    /* Write results... */
+    printf("%d %g %g %g %g %g\n", n, t_product, t_invert, t_solve, res,
+	   t_inv_chol);
+    fflush(stdout);
+
+    /* Free... */
+    gsl_matrix_free(k);
+    gsl_matrix_free(s_a);
+    gsl_matrix_free(a);
+    gsl_matrix_free(cov);
+    gsl_vector_free(sig_eps_inv);
+    gsl_vector_free(b);
+    gsl_vector_free(x);
+    gsl_vector_free(r);
+  }
+
+  /* Free... */
+  gsl_rng_free(rng);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,76 @@
+/*
+  This file is part of JURASSIC.
+  
+  JURASSIC is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  JURASSIC is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with JURASSIC. If not, see <http://www.gnu.org/licenses/>.
+  
+  Copyright (C) 2013-2025 Forschungszentrum Juelich GmbH
+*/
+
+/*! 
+  \file
+  Convert matrix files.
+*/
+
+#include "jurassic.h"
+
+int main(
+  int argc,
+  char *argv[]) {
+
+  static ctl_t ctl;
+
+  static atm_t atm;
+
+  static obs_t obs;
+
+  /* Check arguments... */
+  if (argc < 10)
+    ERRMSG("Give parameters: <ctl> <obs> <atm> <rowspace> <colspace>"
+	   " <matrix_in> <matrixfmt_in> <matrix_out> <matrixfmt_out>");
+
+  /* Read control parameters... */
+  read_ctl(argc, argv, &ctl);
+
+  /* Read observation geometry... */
+  read_obs(NULL, argv[2], &ctl, &obs);
+
+  /* Read atmospheric data... */
+  read_atm(NULL, argv[3], &ctl, &atm);
+
+  /* Get matrix size... */
+  const size_t nr = (argv[4][0] == 'y' ? obs2y(&ctl, &obs, NULL, NULL, NULL)
+		     : atm2x(&ctl, &atm, NULL, NULL, NULL));
+  const size_t nc = (argv[5][0] == 'y' ? obs2y(&ctl, &obs, NULL, NULL, NULL)
+		     : atm2x(&ctl, &atm, NULL, NULL, NULL));
+  if (nr == 0 || nc == 0)
+    ERRMSG("Empty row or column space!");
+
+  /* Allocate... */
+  gsl_matrix *matrix = gsl_matrix_alloc(nr, nc);
+
+  /* Read matrix... */
+  ctl.matrixfmt = atoi(argv[7]);
+  read_matrix(NULL, argv[6], &ctl, matrix);
+
+  /* Write matrix... */
+  ctl.write_matrix = 1;
+  ctl.matrixfmt = atoi(argv[9]);
+  write_matrix(NULL, argv[8], &ctl, matrix, &atm, &obs, argv[4], argv[5],
+	       "r");
+
+  /* Free... */
+  gsl_matrix_free(matrix);
+
+  return EXIT_SUCCESS;
+}
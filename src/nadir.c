@@ -48,11 +48,11 @@ int main(
   /* Create measurement geometry... */
   for (double t = t0; t <= t1; t += dt)
     for (double lat = lat0; lat <= lat1; lat += dlat) {
+      alloc_obs(&ctl, &obs, obs.nr + 1);
       obs.time[obs.nr] = t;
       obs.obsz[obs.nr] = obsz;
       obs.vplat[obs.nr] = lat;
-      if ((++obs.nr) >= NR)
-	ERRMSG("Too many rays!");
+      obs.nr++;
     }
 
   /* Write observation data... */
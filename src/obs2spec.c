@@ -90,6 +90,7 @@ int main(
   fclose(out);
 
   /* Free... */
+  free_obs(obs);
   free(obs);
 
   return EXIT_SUCCESS;
@@ -0,0 +1,155 @@
+/*
+  This file is part of JURASSIC.
+  
+  JURASSIC is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  JURASSIC is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with JURASSIC. If not, see <http://www.gnu.org/licenses/>.
+  
+  Copyright (C) 2013-2025 Forschungszentrum Juelich GmbH
+*/
+
+/*! 
+  \file
+  Pack atmospheric and observation data into a profile container.
+*/
+
+#include "jurassic.h"
+
+int main(
+  int argc,
+  char *argv[]) {
+
+  static ctl_t ctl;
+
+  static atm_t atm, atm2;
+
+  static obs_t obs, obs2;
+
+  prf_t prf;
+
+  char dirlist[LEN], wrkdir[LEN];
+
+  size_t nrec = 0;
+
+  /* Check arguments... */
+  if (argc < 5)
+    ERRMSG("Give parameters: <ctl> <prf> <obs> <atm>");
+
+  /* Read control parameters... */
+  read_ctl(argc, argv, &ctl);
+
+  /* Get dirlist... */
+  scan_ctl(argc, argv, "DIRLIST", -1, "-", dirlist);
+
+  /* Split single files by time... */
+  if (dirlist[0] == '-') {
+
+    /* Read observation geometry... */
+    read_obs(NULL, argv[3], &ctl, &obs);
+
+    /* Read atmospheric data... */
+    read_atm(NULL, argv[4], &ctl, &atm);
+
+    /* Count records (ray paths with the same time)... */
+    for (int ir = 0; ir < obs.nr; ir++)
+      if (ir == 0 || obs.time[ir] != obs.time[ir - 1])
+	nrec++;
+
+    /* Create profile container... */
+    write_prf_create(argv[2], &ctl, nrec, &prf);
+
+    /* Loop over records... */
+    alloc_atm(&ctl, &atm2, atm.np);
+    alloc_obs(&ctl, &obs2, obs.nr);
+    for (int ir0 = 0, rec = 0; ir0 < obs.nr; rec++) {
+
+      /* Get observation data... */
+      obs2.nr = 0;
+      for (int ir = ir0; ir < obs.nr && obs.time[ir] == obs.time[ir0]; ir++) {
+	obs2.time[obs2.nr] = obs.time[ir];
+	obs2.obsz[obs2.nr] = obs.obsz[ir];
+	obs2.obslon[obs2.nr] = obs.obslon[ir];
+	obs2.obslat[obs2.nr] = obs.obslat[ir];
+	obs2.vpz[obs2.nr] = obs.vpz[ir];
+	obs2.vplon[obs2.nr] = obs.vplon[ir];
+	obs2.vplat[obs2.nr] = obs.vplat[ir];
+	obs2.tpz[obs2.nr] = obs.tpz[ir];
+	obs2.tplon[obs2.nr] = obs.tplon[ir];
+	obs2.tplat[obs2.nr] = obs.tplat[ir];
+	for (int id = 0; id < ctl.nd; id++) {
+	  obs2.rad[id][obs2.nr] = obs.rad[id][ir];
+	  obs2.tau[id][obs2.nr] = obs.tau[id][ir];
+	}
+	obs2.nr++;
+      }
+
+      /* Get atmospheric data... */
+      atm2.np = 0;
+      for (int ip = 0; ip < atm.np; ip++)
+	if (atm.time[ip] == obs.time[ir0]) {
+	  atm2.time[atm2.np] = atm.time[ip];
+	  atm2.z[atm2.np] = atm.z[ip];
+	  atm2.lon[atm2.np] = atm.lon[ip];
+	  atm2.lat[atm2.np] = atm.lat[ip];
+	  atm2.p[atm2.np] = atm.p[ip];
+	  atm2.t[atm2.np] = atm.t[ip];
+	  for (int ig = 0; ig < ctl.ng; ig++)
+	    atm2.q[ig][atm2.np] = atm.q[ig][ip];
+	  for (int iw = 0; iw < ctl.nw; iw++)
+	    atm2.k[iw][atm2.np] = atm.k[iw][ip];
+	  atm2.np++;
+	}
+      if (atm2.np < 1)
+	ERRMSG("No atmospheric data for time %.2f!", obs.time[ir0]);
+
+      /* Write record... */
+      write_prf_single(&prf, &ctl, (size_t) rec, &atm2, &obs2);
+      ir0 += obs2.nr;
+    }
+  }
+
+  /* Work on directory list... */
+  else {
+
+    /* Count directories... */
+    FILE *in;
+    if (!(in = fopen(dirlist, "r")))
+      ERRMSG("Cannot open directory list!");
+    while (fscanf(in, "%4999s", wrkdir) != EOF)
+      nrec++;
+
+    /* Create profile container... */
+    write_prf_create(argv[2], &ctl, nrec, &prf);
+
+    /* Loop over directories... */
+    rewind(in);
+    for (size_t rec = 0; rec < nrec; rec++) {
+      if (fscanf(in, "%4999s", wrkdir) != 1)
+	ERRMSG("Error while reading directory list!");
+      read_obs(wrkdir, argv[3], &ctl, &obs);
+      read_atm(wrkdir, argv[4], &ctl, &atm);
+      write_prf_single(&prf, &ctl, rec, &atm, &obs);
+    }
+    fclose(in);
+  }
+
+  /* Close profile container... */
+  write_prf_close(&prf);
+
+  /* Free... */
+  free_atm(&atm);
+  free_atm(&atm2);
+  free_obs(&obs);
+  free_obs(&obs2);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,62 @@
+/*
+  This file is part of JURASSIC.
+  
+  JURASSIC is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  JURASSIC is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with JURASSIC. If not, see <http://www.gnu.org/licenses/>.
+  
+  Copyright (C) 2013-2025 Forschungszentrum Juelich GmbH
+*/
+
+/*! 
+  \file
+  Extract a record from a profile container.
+*/
+
+#include "jurassic.h"
+
+int main(
+  int argc,
+  char *argv[]) {
+
+  static ctl_t ctl;
+
+  static atm_t atm;
+
+  static obs_t obs;
+
+  prf_t prf;
+
+  /* Check arguments... */
+  if (argc < 6)
+    ERRMSG("Give parameters: <ctl> <prf> <rec> <obs> <atm>");
+
+  /* Read control parameters... */
+  read_ctl(argc, argv, &ctl);
+
+  /* Read record... */
+  read_prf_open(argv[2], &ctl, &prf);
+  read_prf_single(&prf, &ctl, (size_t) atol(argv[3]), &atm, &obs);
+  read_prf_close(&prf);
+
+  /* Write observation data... */
+  write_obs(NULL, argv[4], &ctl, &obs);
+
+  /* Write atmospheric data... */
+  write_atm(NULL, argv[5], &ctl, &atm);
+
+  /* Free... */
+  free_atm(&atm);
+  free_obs(&obs);
+
+  return EXIT_SUCCESS;
+}
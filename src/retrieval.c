@@ -24,6 +24,21 @@
 
 #include "jurassic.h"
 
+/* ------------------------------------------------------------
+   Functions...
+   ------------------------------------------------------------ */
+
+/*! Perform retrieval in a single directory or for a single record. */
+void call_retrieval(
+  const ret_t * ret,
+  const ctl_t * ctl,
+  const tbl_t * tbl,
+  const char *dir,
+  prf_t * prf_in,
+  prf_t * prf_out,
+  const size_t rec,
+  warm_t * warm);
+
 /* ------------------------------------------------------------
    Main...
    ------------------------------------------------------------ */
@@ -32,13 +47,17 @@ int main(
   int argc,
   char *argv[]) {
 
-  static atm_t atm_i, atm_apr;
   static ctl_t ctl;
-  static obs_t obs_i, obs_meas;
   static ret_t ret;
+  static warm_t warm;
+  static prf_t prf_in, prf_out;
 
   FILE *dirlist;
 
+  char **dirs = NULL, batch[LEN], batchout[LEN], dir[LEN];
+
+  int ndir = 0;
+
   /* Check arguments... */
   if (argc < 3)
     ERRMSG("Give parameters: <ctl> <dirlist>");
@@ -50,42 +69,193 @@ int main(
   read_ctl(argc, argv, &ctl);
   read_ret(argc, argv, &ctl, &ret);
 
+  /* Get number of directories processed in parallel... */
+  const int dirpar = (int) scan_ctl(argc, argv, "DIRPAR", -1, "1", NULL);
+  if (dirpar < 1)
+    ERRMSG("DIRPAR must be positive!");
+
   /* Initialize look-up tables... */
   tbl_t *tbl = read_tbl(&ctl);
 
-  /* Open directory list... */
-  if (!(dirlist = fopen(argv[2], "r")))
-    ERRMSG("Cannot open directory list!");
+  /* Get profile containers... */
+  scan_ctl(argc, argv, "BATCH", -1, "-", batch);
+  scan_ctl(argc, argv, "BATCHOUT", -1, "-", batchout);
 
-  /* Loop over directories... */
-  while (fscanf(dirlist, "%4999s", ret.dir) != EOF) {
+  /* Open profile containers... */
+  prf_t *pin = NULL, *pout = NULL;
+  if (batch[0] != '-') {
+    if (batchout[0] == '-')
+      ERRMSG("Set BATCHOUT to process a profile container!");
+    read_prf_open(batch, &ctl, &prf_in);
+    write_prf_create(batchout, &ctl, prf_in.n, &prf_out);
+    pin = &prf_in;
+    pout = &prf_out;
+    ndir = (int) prf_in.n;
 
-    /* Write info... */
-    LOG(1, "\nRetrieve in directory %s...\n", ret.dir);
+    /* Per-record output files are not available... */
+    if (ret.err_ana || ctl.write_matrix) {
+      WARN("ERR_ANA and WRITE_MATRIX are disabled for profile containers!");
+      ret.err_ana = 0;
+      ctl.write_matrix = 0;
+    }
+  }
 
-    /* Read atmospheric data... */
-    read_atm(ret.dir, "atm_apr.tab", &ctl, &atm_apr);
+  /* Read directory list... */
+  else {
+    if (!(dirlist = fopen(argv[2], "r")))
+      ERRMSG("Cannot open directory list!");
+    while (fscanf(dirlist, "%4999s", dir) != EOF)
+      ndir++;
+    ALLOC(dirs, char *,
+	  ndir);
+    rewind(dirlist);
+    for (int idir = 0; idir < ndir; idir++) {
+      if (fscanf(dirlist, "%4999s", dir) != 1)
+	ERRMSG("Error while reading directory list!");
+      ALLOC(dirs[idir], char,
+	    strlen(dir) + 1);
+      strcpy(dirs[idir], dir);
+    }
+    fclose(dirlist);
+  }
 
-    /* Read observation data... */
-    read_obs(ret.dir, "obs_meas.tab", &ctl, &obs_meas);
+  /* Sequential processing... */
+  if (dirpar == 1)
+    for (int idir = 0; idir < ndir; idir++) {
+
+      /* Run retrieval... */
+      call_retrieval(&ret, &ctl, tbl, dirs ? dirs[idir] : NULL, pin, pout,
+		     (size_t) idir, ret.warm_start ? &warm : NULL);
+
+      /* Measure CPU-time... */
+      TIMER("total", 2);
+    }
+
+  /* Parallel processing of directories... */
+  else {
+
+    /* Check warm start... */
+    if (ret.warm_start)
+      WARN("Warm start is disabled for parallel processing (DIRPAR > 1)!");
+
+    /* Split thread budget between directories and kernel calculations... */
+    const int nthreads = MAX(omp_get_max_threads() / dirpar, 1);
+    omp_set_max_active_levels(2);
+    LOG(1, "Retrieve %d directories in parallel, %d thread(s) each...",
+	dirpar, nthreads);
 
-    /* Run retrieval... */
-    double chisq;
-    optimal_estimation(&ret, &ctl, tbl, &obs_meas, &obs_i, &atm_apr, &atm_i,
-		       &chisq);
+#pragma omp parallel for schedule(dynamic) num_threads(dirpar) default(none) shared(ret,ctl,tbl,dirs,ndir,nthreads,pin,pout)
+    for (int idir = 0; idir < ndir; idir++) {
 
-    /* Measure CPU-time... */
-    TIMER("total", 2);
+      /* Set number of threads for kernel calculations... */
+      omp_set_num_threads(nthreads);
+
+      /* Buffer log messages... */
+      log_buffer_open();
+
+      /* Run retrieval... */
+      TIMER("retrieval", 1);
+      call_retrieval(&ret, &ctl, tbl, dirs ? dirs[idir] : NULL, pin, pout,
+		     (size_t) idir, NULL);
+      TIMER("retrieval", 3);
+
+      /* Write log messages... */
+      log_buffer_close();
+    }
   }
 
+  /* Wait for pending output... */
+  write_async_flush();
+
   /* Write info... */
   LOG(1, "\nRetrieval done...");
 
   /* Measure CPU-time... */
   TIMER("total", 3);
 
+  /* Close profile containers... */
+  if (pin != NULL) {
+    read_prf_close(pin);
+    write_prf_close(pout);
+  }
+
   /* Free... */
+  if (dirs != NULL)
+    for (int idir = 0; idir < ndir; idir++)
+      free(dirs[idir]);
+  free(dirs);
   free(tbl);
+  free_atm(&warm.atm);
+  free_obs(&warm.obs);
+  if (warm.k != NULL)
+    gsl_matrix_free(warm.k);
 
   return EXIT_SUCCESS;
 }
+
+/*****************************************************************************/
+
+void call_retrieval(
+  const ret_t *ret,
+  const ctl_t *ctl,
+  const tbl_t *tbl,
+  const char *dir,
+  prf_t *prf_in,
+  prf_t *prf_out,
+  const size_t rec,
+  warm_t *warm) {
+
+  atm_t *atm_apr, *atm_i;
+  obs_t *obs_i, *obs_meas;
+  ret_t *ret2;
+
+  /* Allocate... */
+  ALLOC(atm_apr, atm_t, 1);
+  ALLOC(atm_i, atm_t, 1);
+  ALLOC(obs_i, obs_t, 1);
+  ALLOC(obs_meas, obs_t, 1);
+  ALLOC(ret2, ret_t, 1);
+
+  /* Set working directory... */
+  memcpy(ret2, ret, sizeof(ret_t));
+  sprintf(ret2->dir, "%s", dir != NULL ? dir : ".");
+
+  /* Read record from profile container... */
+  if (prf_in != NULL) {
+    LOG(1, "\nRetrieve record %zu...\n", rec);
+    read_prf_single(prf_in, ctl, rec, atm_apr, obs_meas);
+  }
+
+  /* Read data from working directory... */
+  else {
+
+    /* Write info... */
+    LOG(1, "\nRetrieve in directory %s...\n", ret2->dir);
+
+    /* Read atmospheric data... */
+    read_atm(ret2->dir, "atm_apr.tab", ctl, atm_apr);
+
+    /* Read observation data... */
+    read_obs(ret2->dir, "obs_meas.tab", ctl, obs_meas);
+  }
+
+  /* Run retrieval... */
+  double chisq;
+  optimal_estimation(ret2, ctl, tbl, obs_meas, obs_i, atm_apr, atm_i, &chisq,
+		     warm);
+
+  /* Write record to profile container... */
+  if (prf_out != NULL)
+    write_prf_single(prf_out, ctl, rec, atm_i, obs_i);
+
+  /* Free... */
+  free_atm(atm_apr);
+  free_atm(atm_i);
+  free_obs(obs_i);
+  free_obs(obs_meas);
+  free(atm_apr);
+  free(atm_i);
+  free(obs_i);
+  free(obs_meas);
+  free(ret2);
+}